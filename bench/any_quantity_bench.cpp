@@ -0,0 +1,154 @@
+// NOLINTBEGIN(readability-magic-numbers) — benchmark
+// Runtime-typed quantities: a std::variant over 24 unit types against AnyQuantity. Reports the
+// object sizes and the cost of summing the length entries of a mixed array in metres, by visiting
+// the variant and by AnyQuantity::as<Meters>() (mixed scales, then the matching-descriptor fast path).
+//
+//   any_quantity_bench [elements] [rounds]   (default 1000000 20)
+
+#include "strong-types/any_quantity.hpp"
+#include "strong-types/clock.hpp"
+#include "strong-types/si_scaled.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+using namespace strong_types;
+
+namespace
+{
+
+using Meters = unit_t<double, LengthTag>;
+
+using Boxed = std::variant<Meters, Kilometers<double>, Centimeters<double>, Millimeters<double>, Micrometers<double>,
+                           unit_t<double, TimeTag>, Nanoseconds<double>, Microseconds<double>, Milliseconds<double>,
+                           Minutes<double>, Hours<double>, unit_t<double, MassTag>, Grams<double>, Milligrams<double>,
+                           Tons<double>, unit_t<double, SpeedTag>, KilometersPerHour<double>,
+                           unit_t<double, AccelerationTag>, unit_t<double, ForceTag>, unit_t<double, EnergyTag>,
+                           unit_t<double, PowerTag>, unit_t<double, PressureTag>, unit_t<double, HertzTag>,
+                           unit_t<double, VoltTag>>;
+
+/// Deterministic pseudo-random stream so every run sees the same mix
+class Lcg
+{
+public:
+    std::uint32_t next() noexcept
+    {
+        state_ = state_ * 6364136223846793005ULL + 1442695040888963407ULL;
+        return static_cast<std::uint32_t>(state_ >> 33U);
+    }
+
+private:
+    std::uint64_t state_{42};
+};
+
+template <std::size_t I = 0>
+void fill(Boxed &boxed, AnyQuantity &any, std::size_t index, double value)
+{
+    if constexpr (I < std::variant_size_v<Boxed>)
+    {
+        if (index == I)
+        {
+            using Q = std::variant_alternative_t<I, Boxed>;
+            const Q quantity{value};
+            boxed = quantity;
+            any = AnyQuantity{quantity};
+            return;
+        }
+        fill<I + 1>(boxed, any, index, value);
+    }
+}
+
+template <typename Body>
+void run(const char *label, std::size_t elements, int rounds, Body body)
+{
+    double sink = 0.0;
+    const auto begin = steady_now_ns().get();
+    for (int r = 0; r < rounds; ++r)
+    {
+        sink += body();
+    }
+    const auto elapsed_ns = static_cast<double>(steady_now_ns().get() - begin);
+    std::printf("%-34s %7.2f ns/element   (checksum %.6g)\n", label,
+                elapsed_ns / (static_cast<double>(elements) * static_cast<double>(rounds)), sink);
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const auto elements = static_cast<std::size_t>(argc > 1 ? std::atoll(argv[1]) : 1'000'000);
+    const int rounds = argc > 2 ? std::atoi(argv[2]) : 20;
+
+    std::printf("sizeof(std::variant<24 units>) = %zu   sizeof(AnyQuantity) = %zu\n\n", sizeof(Boxed),
+                sizeof(AnyQuantity));
+
+    std::vector<Boxed> boxed(elements);
+    std::vector<AnyQuantity> any(elements);
+    std::vector<AnyQuantity> meters(elements);
+    Lcg rng;
+    for (std::size_t i = 0; i < elements; ++i)
+    {
+        const double value = static_cast<double>(rng.next() % 1000U);
+        fill(boxed[i], any[i], rng.next() % std::variant_size_v<Boxed>, value);
+        meters[i] = AnyQuantity{Meters{value}};
+    }
+
+    run("variant: std::visit", elements, rounds, [&] {
+        double sum = 0.0;
+        for (const auto &item : boxed)
+        {
+            sum += std::visit(
+                [](const auto &q) {
+                    using Q = std::remove_cvref_t<decltype(q)>;
+                    if constexpr (std::is_same_v<typename Q::tag_type, LengthTag>)
+                    {
+                        if constexpr (is_scaled_v<Q>)
+                        {
+                            return q.to_base().get();
+                        }
+                        else
+                        {
+                            return q.get();
+                        }
+                    }
+                    else
+                    {
+                        return 0.0;
+                    }
+                },
+                item);
+        }
+        return sum;
+    });
+
+    run("AnyQuantity::as<Meters> (mixed)", elements, rounds, [&] {
+        double sum = 0.0;
+        for (const auto &item : any)
+        {
+            if (const auto m = item.as<Meters>())
+            {
+                sum += m->get();
+            }
+        }
+        return sum;
+    });
+
+    run("AnyQuantity::as<Meters> (matching)", elements, rounds, [&] {
+        double sum = 0.0;
+        for (const auto &item : meters)
+        {
+            if (const auto m = item.as<Meters>())
+            {
+                sum += m->get();
+            }
+        }
+        return sum;
+    });
+    return 0;
+}
+
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,94 @@
+// NOLINTBEGIN(readability-magic-numbers) — benchmark
+// Startup cost of loading a unit_t<double, LengthTag> column from disk: fread of the values into a
+// std::vector against MappedColumn::open. Both then sum the column once. The file is written first,
+// so both loads read it from the page cache.
+//
+//   column_file_bench [elements] [path]   (default 16000000 /tmp/strong_types_column_bench.col)
+
+#include "strong-types/clock.hpp"
+#include "strong-types/column_file.hpp"
+#include "strong-types/si.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <span>
+#include <vector>
+
+using namespace strong_types;
+
+namespace
+{
+
+using Depth = unit_t<double, LengthTag>;
+
+struct FileCloser
+{
+    void operator()(std::FILE *file) const noexcept
+    {
+        static_cast<void>(std::fclose(file));
+    }
+};
+
+void report(const char *label, std::int64_t open_ns, std::int64_t sum_ns, double total)
+{
+    std::printf("%-24s open %9.3f ms   first sum %8.2f ms   (sum %.0f)\n", label, static_cast<double>(open_ns) / 1e6,
+                static_cast<double>(sum_ns) / 1e6, total);
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const auto elements = static_cast<std::size_t>(argc > 1 ? std::atoll(argv[1]) : 16'000'000);
+    const char *path = argc > 2 ? argv[2] : "/tmp/strong_types_column_bench.col";
+
+    {
+        std::vector<Depth> values;
+        values.reserve(elements);
+        for (std::size_t i = 0; i < elements; ++i)
+        {
+            values.emplace_back(static_cast<double>(i % 1000));
+        }
+        if (!write_column(path, std::span<const Depth>{values}))
+        {
+            std::printf("cannot write %s\n", path);
+            return 1;
+        }
+    }
+    std::printf("%zu elements, %.1f MiB\n", elements, static_cast<double>(elements * sizeof(double)) / 1048576.0);
+
+    {
+        const auto begin = steady_now_ns().get();
+        std::vector<double> loaded(elements);
+        {
+            const std::unique_ptr<std::FILE, FileCloser> file{std::fopen(path, "rb")};
+            if (!file || std::fseek(file.get(), COLUMN_DATA_OFFSET, SEEK_SET) != 0 ||
+                std::fread(loaded.data(), sizeof(double), elements, file.get()) != elements)
+            {
+                std::printf("cannot read %s\n", path);
+                return 1;
+            }
+        }
+        const auto opened = steady_now_ns().get();
+        const auto total = sum(unit_span<const double, LengthTag>{loaded.data(), loaded.size()});
+        report("fread into vector", opened - begin, steady_now_ns().get() - opened, total.get());
+    }
+    {
+        const auto begin = steady_now_ns().get();
+        const auto column = MappedColumn<Depth>::open(path);
+        if (!column)
+        {
+            std::printf("cannot map %s\n", path);
+            return 1;
+        }
+        const auto opened = steady_now_ns().get();
+        const auto total = sum(column->view());
+        report("MappedColumn::open", opened - begin, steady_now_ns().get() - opened, total.get());
+    }
+    std::remove(path);
+    return 0;
+}
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,225 @@
+#!/usr/bin/env python3
+"""Compile-time cost benchmark for the strong-types headers.
+
+Generates synthetic translation units that use N distinct tags, M scaled ratios and K operator
+chains, compiles each with every available compiler, and writes one JSON report with wall-clock
+time, peak compiler RSS, the compiler's own phase timings and template instantiation counts:
+
+  * GCC   -ftime-report phases; instantiations are counted as emitted template functions (nm, -O0)
+  * Clang -ftime-trace events; InstantiateClass / InstantiateFunction are counted exactly
+
+Usage:
+  compile_time_bench.py --include include --out compile_time.json
+  compile_time_bench.py --tags 8,32 --ratios 4,16 --chains 16,128 --compiler g++ --compiler clang++
+"""
+
+import argparse
+import itertools
+import json
+import os
+import platform
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+from pathlib import Path
+
+
+# ---- TU generation ----
+
+
+def generate_tu(tags: int, ratios: int, chains: int, with_fmt: bool) -> str:
+    """One TU: `tags` custom tags with sum/product traits, `ratios` scaled lengths, `chains` functions."""
+    out = [
+        '#include "strong-types/si.hpp"',
+        '#include "strong-types/si_scaled.hpp"',
+    ]
+    if with_fmt:
+        out += ['#include "strong-types/fmt.hpp"', "#include <string>"]
+    out += ["#include <ratio>", "", "namespace bench", "{"]
+    out += [f"struct Tag{i};" for i in range(tags)]
+    out += ["} // namespace bench", "", "namespace strong_types", "{"]
+    for i in range(tags):
+        tag, nxt, res = f"bench::Tag{i}", f"bench::Tag{(i + 1) % tags}", f"bench::Tag{(i + 2) % tags}"
+        out += [
+            f"template <> struct tag_sum_result<{tag}, {tag}> {{ using type = {tag}; }};",
+            f"template <> struct tag_difference_result<{tag}, {tag}> {{ using type = {tag}; }};",
+            f"template <> struct tag_product_result<{tag}, {nxt}> {{ using type = {res}; }};",
+        ]
+    out += ["} // namespace strong_types", "", "namespace bench", "{", "using namespace strong_types;", ""]
+    out += [f"using R{j} = std::ratio<1, {j + 2}>;" for j in range(ratios)]
+    out.append("")
+
+    for k in range(chains):
+        i, j = k % tags, k % ratios
+        i1, j1 = (i + 1) % tags, (j + 1) % ratios
+        out += [
+            f"double chain{k}(double x)",
+            "{",
+            f"    const unit_t<double, Tag{i}> a{{x}};",
+            f"    const unit_t<double, Tag{i1}> b{{x + 1.0}};",
+            "    const auto c = (a + a - a) * b;",
+            f"    const ScaledUnit<double, LengthTag, R{j}> s{{x}};",
+            f"    const ScaledUnit<double, LengthTag, R{j1}> t{{x + 2.0}};",
+            "    const auto u = s + t;",
+            f"    const auto v = s.in<R{j1}>() + t * 2.0;",
+            "    return c.get() + u.get() + v.get() + (s < t ? 1.0 : 0.0);",
+            "}",
+        ]
+        if with_fmt:
+            out += [
+                f"std::string format{k}(double x)",
+                "{",
+                f"    return fmt::format(\"{{:.2f}} {{}}\", ScaledUnit<double, LengthTag, R{j}>{{x}}, unit_t<double, Tag{i}>{{x}});",
+                "}",
+            ]
+    out += ["} // namespace bench", ""]
+    return "\n".join(out)
+
+
+# ---- compiler drivers ----
+
+
+def compiler_info(cxx: str) -> dict:
+    first = subprocess.run([cxx, "--version"], capture_output=True, text=True, check=True).stdout.splitlines()[0]
+    return {"command": cxx, "family": "clang" if "clang" in first.lower() else "gcc", "version": first.strip()}
+
+
+def run_measured(cmd: list) -> tuple:
+    """Run `cmd`; return (wall seconds, peak RSS in KiB of the process tree, stderr text)."""
+    start = time.perf_counter()
+    proc = subprocess.Popen(cmd, stdout=subprocess.DEVNULL, stderr=subprocess.PIPE, text=True)
+    stderr = proc.stderr.read()
+    _, status, usage = os.wait4(proc.pid, 0)
+    wall = time.perf_counter() - start
+    proc.returncode = os.waitstatus_to_exitcode(status)
+    if proc.returncode != 0:
+        sys.stderr.write(stderr)
+        raise subprocess.CalledProcessError(proc.returncode, cmd)
+    # ru_maxrss of a reaped child covers its own reaped descendants (cc1plus / clang -cc1)
+    return wall, usage.ru_maxrss, stderr
+
+
+GCC_PHASE = re.compile(
+    r"^\s*(?P<name>[^:]+?)\s*:\s*(?P<usr>[\d.]+)\s*(?:\(\s*\d+%\))?\s*(?P<sys>[\d.]+)\s*(?:\(\s*\d+%\))?"
+    r"\s*(?P<wall>[\d.]+)"
+)
+
+
+def parse_gcc_time_report(stderr: str) -> dict:
+    phases = {}
+    for line in stderr.splitlines():
+        match = GCC_PHASE.match(line)
+        if match:
+            phases[match["name"]] = float(match["wall"])
+    return phases
+
+
+def count_emitted_templates(obj: Path) -> int:
+    nm = shutil.which("nm")
+    if nm is None:
+        return -1
+    symbols = subprocess.run([nm, "-C", "--defined-only", str(obj)], capture_output=True, text=True).stdout
+    return sum(1 for line in symbols.splitlines() if ">(" in line or ">::" in line)
+
+
+def parse_clang_time_trace(trace: Path) -> tuple:
+    events = json.loads(trace.read_text())["traceEvents"]
+    phases, counts = {}, {"InstantiateClass": 0, "InstantiateFunction": 0}
+    for event in events:
+        name = event.get("name", "")
+        if name in counts and event.get("ph") == "X":
+            counts[name] += 1
+        elif name.startswith("Total ") and "dur" in event:
+            phases[name[len("Total "):]] = event["dur"] / 1e6
+    return phases, {"class": counts["InstantiateClass"], "function": counts["InstantiateFunction"]}
+
+
+def compile_once(info: dict, source: Path, workdir: Path, base_flags: list) -> dict:
+    obj = workdir / (source.stem + ".o")
+    if info["family"] == "gcc":
+        cmd = [info["command"], *base_flags, "-ftime-report", "-c", str(source), "-o", str(obj)]
+        wall, rss, stderr = run_measured(cmd)
+        phases = parse_gcc_time_report(stderr)
+        instantiations = {"emitted_functions": count_emitted_templates(obj)}
+    else:
+        cmd = [info["command"], *base_flags, "-ftime-trace", "-ftime-trace-granularity=0", "-c", str(source), "-o",
+               str(obj)]
+        wall, rss, _ = run_measured(cmd)
+        phases, instantiations = parse_clang_time_trace(obj.with_suffix(".json"))
+    return {"wall_s": wall, "peak_rss_kib": rss, "phases_s": phases, "template_instantiations": instantiations}
+
+
+# ---- driver ----
+
+
+def int_list(text: str) -> list:
+    return [int(v) for v in text.split(",") if v]
+
+
+def main() -> int:
+    root = Path(__file__).resolve().parents[2]
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--include", default=str(root / "include"), help="strong-types include directory")
+    parser.add_argument("--compiler", action="append", help="compiler to run (repeatable; default: g++ and clang++)")
+    parser.add_argument("--tags", type=int_list, default=[4, 16, 64], help="N distinct tags, comma separated")
+    parser.add_argument("--ratios", type=int_list, default=[4, 16], help="M scaled ratios, comma separated")
+    parser.add_argument("--chains", type=int_list, default=[32, 256], help="K operator chains, comma separated")
+    parser.add_argument("--fmt", action="store_true", help="also include fmt.hpp and format every chain")
+    parser.add_argument("--dimension-engine", action="store_true", help="define STRONG_TYPES_DIMENSION_ENGINE=1")
+    parser.add_argument("--repeat", type=int, default=3, help="compiles per case; the fastest is reported")
+    parser.add_argument("--std", default="c++23")
+    parser.add_argument("--flag", action="append", default=[], help="extra compiler flag (repeatable)")
+    parser.add_argument("--label", default="", help="free-form label, e.g. the library version")
+    parser.add_argument("--out", default="compile_time.json", help="JSON report path ('-' for stdout)")
+    args = parser.parse_args()
+
+    compilers = [c for c in (args.compiler or ["g++", "clang++"]) if shutil.which(c)]
+    if not compilers:
+        sys.stderr.write("no compiler found\n")
+        return 1
+
+    flags = [f"-std={args.std}", f"-I{args.include}", "-O0", *args.flag]
+    if args.dimension_engine:
+        flags.append("-DSTRONG_TYPES_DIMENSION_ENGINE=1")
+
+    report = {
+        "label": args.label,
+        "host": platform.node(),
+        "machine": platform.machine(),
+        "timestamp": time.strftime("%Y-%m-%dT%H:%M:%SZ", time.gmtime()),
+        "flags": flags,
+        "fmt": args.fmt,
+        "compilers": [],
+        "results": [],
+    }
+
+    with tempfile.TemporaryDirectory(prefix="strong_types_ct_") as tmp:
+        workdir = Path(tmp)
+        for cxx in compilers:
+            info = compiler_info(cxx)
+            report["compilers"].append(info)
+            for tags, ratios, chains in itertools.product(args.tags, args.ratios, args.chains):
+                source = workdir / f"tu_{tags}_{ratios}_{chains}.cpp"
+                source.write_text(generate_tu(tags, ratios, chains, args.fmt))
+                runs = [compile_once(info, source, workdir, flags) for _ in range(max(args.repeat, 1))]
+                best = min(runs, key=lambda r: r["wall_s"])
+                best.update({"compiler": info["command"], "tags": tags, "ratios": ratios, "chains": chains,
+                             "wall_s_all": [r["wall_s"] for r in runs]})
+                report["results"].append(best)
+                print(f"{info['family']:5} N={tags:<4} M={ratios:<4} K={chains:<5} "
+                      f"{best['wall_s'] * 1e3:8.1f} ms  {best['peak_rss_kib'] / 1024:7.1f} MiB  "
+                      f"instantiations={best['template_instantiations']}", file=sys.stderr)
+
+    text = json.dumps(report, indent=2)
+    if args.out == "-":
+        print(text)
+    else:
+        Path(args.out).write_text(text + "\n")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
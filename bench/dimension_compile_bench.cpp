@@ -0,0 +1,58 @@
+// Compile-time benchmark: every tag product/quotient in si.hpp, instantiated for each arithmetic
+// value type. Build once per mode and compare (see bench/dimension_compile_bench.sh):
+//   -DSTRONG_TYPES_DIMENSION_ENGINE=0   hand-written tag_product_result / tag_quotient_result table
+//   -DSTRONG_TYPES_DIMENSION_ENGINE=1   Dimension exponent vectors
+
+#include "strong-types/si.hpp"
+
+#include <cstdint>
+
+using namespace strong_types;
+
+namespace
+{
+
+template <typename T>
+constexpr T exercise_all()
+{
+    const unit_t<T, LengthTag> m{T{2}};
+    const unit_t<T, MassTag> kg{T{3}};
+    const unit_t<T, TimeTag> s{T{4}};
+
+    const auto area = m * m;
+    const auto volume = m * area;
+    const auto speed = m / s;
+    const auto accel = speed / s;
+    const auto force = kg * accel;
+    const auto energy = force * m;
+    const auto power = energy / s;
+    const auto pressure = force / area;
+    const auto density = kg / volume;
+    const unit_t<T, RadianTag> rad{T{1}};
+    const auto omega = rad / s;
+    const auto torque = power / omega;
+
+    const unit_t<T, LengthTag> back_m = speed * s;
+    const unit_t<T, ForceTag> back_f = accel * kg;
+    const unit_t<T, EnergyTag> back_e = m * force + power * s;
+    const unit_t<T, PowerTag> back_p = torque * omega + omega * torque;
+    const unit_t<T, MassTag> back_kg = density * volume + volume * density;
+    const unit_t<T, AreaTag> back_a = volume / m + area * (m / m) + area;
+    const unit_t<T, LengthTag> back_l = volume / area;
+    const unit_t<T, ForceTag> back_pf = pressure * area + area * pressure;
+    const unit_t<T, TorqueTag> back_t = power / omega;
+    const unit_t<T, RadianTag> back_r = omega * s + s * omega;
+
+    return back_m.get() + back_f.get() + back_e.get() + back_p.get() + back_kg.get() + back_a.get() + back_l.get() +
+           back_pf.get() + back_t.get() + back_r.get() + (power / torque).get();
+}
+
+} // namespace
+
+int main()
+{
+    double sink = exercise_all<double>() + exercise_all<float>() + exercise_all<long double>();
+    sink += static_cast<double>(exercise_all<std::int64_t>() + exercise_all<std::int32_t>());
+    sink += static_cast<double>(exercise_all<std::uint64_t>() + exercise_all<std::uint32_t>());
+    return sink > 0.0 ? 0 : 1;
+}
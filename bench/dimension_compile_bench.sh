@@ -0,0 +1,26 @@
+#!/usr/bin/env bash
+# Compare front-end time of the hand-written tag tables against the Dimension engine.
+# Compiles alternate between the two modes and the fastest of `runs` is reported for each, which
+# keeps machine noise from favouring either side.
+#   bench/dimension_compile_bench.sh [runs] [compiler]
+set -euo pipefail
+
+runs=${1:-20}
+cxx=${2:-${CXX:-c++}}
+root=$(cd "$(dirname "$0")/.." && pwd)
+src="$root/bench/dimension_compile_bench.cpp"
+best=(0 0)
+
+for _ in $(seq "$runs"); do
+    for engine in 0 1; do
+        start=$(date +%s%N)
+        "$cxx" -std=c++23 -fsyntax-only -I"$root/include" -DSTRONG_TYPES_DIMENSION_ENGINE="$engine" "$src"
+        elapsed=$(($(date +%s%N) - start))
+        if [[ "${best[$engine]}" -eq 0 || "$elapsed" -lt "${best[$engine]}" ]]; then
+            best[engine]=$elapsed
+        fi
+    done
+done
+
+printf 'tag tables (STRONG_TYPES_DIMENSION_ENGINE=0)  best %4d ms of %s compiles\n' $((best[0] / 1000000)) "$runs"
+printf 'dimensions (STRONG_TYPES_DIMENSION_ENGINE=1)  best %4d ms of %s compiles\n' $((best[1] / 1000000)) "$runs"
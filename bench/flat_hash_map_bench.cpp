@@ -0,0 +1,106 @@
+// NOLINTBEGIN(readability-magic-numbers) — benchmark
+// Strong<uint64_t, Tag> keys: FlatHashMap against std::unordered_map with the same std::hash.
+// Keys are spread out (multiplied by a large odd constant) so neither map sees sequential integers.
+//
+//   flat_hash_map_bench [keys] [rounds]   (default 200000 20)
+
+#include "strong-types/clock.hpp"
+#include "strong-types/flat_hash_map.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+using namespace strong_types;
+
+namespace
+{
+
+struct EntityIdTag;
+using EntityId = Strong<std::uint64_t, EntityIdTag>;
+
+template <typename Round>
+void run(const char *label, std::size_t ops, int rounds, Round body)
+{
+    double sink = 0.0;
+    const auto begin = steady_now_ns().get();
+    for (int r = 0; r < rounds; ++r)
+    {
+        sink += body();
+    }
+    const auto elapsed_ns = static_cast<double>(steady_now_ns().get() - begin);
+    std::printf("%-36s %8.2f ns/op   (checksum %.6g)\n", label,
+                elapsed_ns / (static_cast<double>(ops) * static_cast<double>(rounds)), sink);
+}
+
+template <typename Map>
+void bench_map(const char *name, const std::vector<EntityId> &keys, const std::vector<EntityId> &misses, int rounds)
+{
+    std::printf("%s\n", name);
+    run("  insert (no reserve)", keys.size(), rounds, [&] {
+        Map map;
+        for (const auto key : keys)
+        {
+            map[key] = key.get();
+        }
+        return static_cast<double>(map.size());
+    });
+
+    Map map;
+    for (const auto key : keys)
+    {
+        map[key] = key.get();
+    }
+    run("  find hit", keys.size(), rounds, [&] {
+        std::uint64_t sum = 0;
+        for (const auto key : keys)
+        {
+            sum += map.find(key)->second;
+        }
+        return static_cast<double>(sum & 0xFFFFU);
+    });
+    run("  find miss", misses.size(), rounds, [&] {
+        std::size_t found = 0;
+        for (const auto key : misses)
+        {
+            found += static_cast<std::size_t>(map.find(key) != map.end());
+        }
+        return static_cast<double>(found);
+    });
+    run("  erase + reinsert", keys.size(), rounds, [&] {
+        for (const auto key : keys)
+        {
+            map.erase(key);
+            map[key] = 1;
+        }
+        return static_cast<double>(map.size());
+    });
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const auto count = static_cast<std::size_t>(argc > 1 ? std::atoll(argv[1]) : 200'000);
+    const int rounds = argc > 2 ? std::atoi(argv[2]) : 20;
+
+    std::vector<EntityId> keys;
+    std::vector<EntityId> misses;
+    for (std::uint64_t i = 0; i < count; ++i)
+    {
+        keys.emplace_back(i * 0x9E3779B97F4A7C15ULL);
+        misses.emplace_back(i * 0x9E3779B97F4A7C15ULL + 1);
+    }
+    std::shuffle(keys.begin(), keys.end(), std::mt19937_64{7});
+
+    bench_map<std::unordered_map<EntityId, std::uint64_t>>("std::unordered_map<EntityId, uint64_t>", keys, misses,
+                                                           rounds);
+    bench_map<FlatHashMap<EntityId, std::uint64_t>>("FlatHashMap<EntityId, uint64_t>", keys, misses, rounds);
+    return 0;
+}
+// NOLINTEND(readability-magic-numbers)
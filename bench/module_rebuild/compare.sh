@@ -0,0 +1,29 @@
+#!/usr/bin/env bash
+# Rebuild time of the same TU set against the headers and against `import strong_types;`.
+#
+#   cmake -S . -B build-mod -G Ninja -DSTRONG_TYPES_BUILD_MODULE=ON -DBUILD_BENCHMARKS=ON -DCMAKE_BUILD_TYPE=Release
+#   bench/module_rebuild/compare.sh build-mod [runs]
+#
+# Each run touches every generated TU and rebuilds one target. The module interface itself is
+# built once up front, so the numbers are the per-edit cost a consumer pays, not a clean build.
+set -euo pipefail
+
+build=${1:?usage: compare.sh <build-dir> [runs]}
+runs=${2:-3}
+jobs=$(nproc 2>/dev/null || echo 4)
+
+cmake --build "$build" --target strong-types_rebuild_headers strong-types_rebuild_module -j "$jobs" >/dev/null
+
+for target in strong-types_rebuild_headers strong-types_rebuild_module; do
+    best=0
+    for _ in $(seq "$runs"); do
+        touch "$build"/module_rebuild/tu_*.cpp
+        start=$(date +%s%N)
+        cmake --build "$build" --target "$target" -j "$jobs" >/dev/null
+        elapsed=$(($(date +%s%N) - start))
+        if [[ "$best" -eq 0 || "$elapsed" -lt "$best" ]]; then
+            best=$elapsed
+        fi
+    done
+    printf '%-32s best %6d ms of %s rebuilds (%s jobs)\n' "$target" $((best / 1000000)) "$runs" "$jobs"
+done
@@ -0,0 +1,96 @@
+// NOLINTBEGIN(readability-magic-numbers) — benchmark
+// Rate limiter throughput: single-producer bucket, and the CAS-based concurrent bucket against a
+// mutex-guarded one as producer threads are added.
+//
+//   rate_limiter_bench [calls-per-thread]   (default 2000000)
+
+#include "strong-types/rate_limiter.hpp"
+#include "strong-types/si_literals.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace strong_types;
+using namespace strong_types::si_literals;
+
+namespace
+{
+
+constexpr int CLOCK_READ_EVERY = 64; // one steady-clock read shared by this many calls
+
+/// Runs `threads` producers calling `acquire(now)` and returns admitted calls and total calls/s
+template <typename Acquire>
+void run(const char *label, unsigned threads, int calls, Acquire acquire)
+{
+    std::atomic<std::uint64_t> admitted{0};
+    std::atomic<bool> go{false};
+    std::vector<std::thread> pool;
+    for (unsigned t = 0; t < threads; ++t)
+    {
+        pool.emplace_back([&] {
+            while (!go.load(std::memory_order_acquire))
+            {
+                cpu_relax();
+            }
+            std::uint64_t local = 0;
+            auto now = steady_now_ns();
+            for (int i = 0; i < calls; ++i)
+            {
+                if (i % CLOCK_READ_EVERY == 0)
+                {
+                    now = steady_now_ns();
+                }
+                local += acquire(now) ? 1U : 0U;
+            }
+            admitted.fetch_add(local, std::memory_order_relaxed);
+        });
+    }
+    const auto begin = steady_now_ns().get();
+    go.store(true, std::memory_order_release);
+    for (auto &th : pool)
+    {
+        th.join();
+    }
+    const auto elapsed_s = static_cast<double>(steady_now_ns().get() - begin) * 1e-9;
+    const auto total = static_cast<double>(threads) * static_cast<double>(calls);
+    std::printf("%-24s threads=%-2u %8.1f Mcalls/s  %6.2f ns/call  admitted=%llu\n", label, threads,
+                total / elapsed_s * 1e-6, elapsed_s * 1e9 / total * static_cast<double>(threads),
+                static_cast<unsigned long long>(admitted.load()));
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const int calls = argc > 1 ? std::atoi(argv[1]) : 2'000'000;
+    const auto rate = 1e8_Hz; // 10 ns per token: a mix of admits and rejects at these call rates
+
+    {
+        TokenBucket bucket{rate, 64};
+        run("TokenBucket", 1, calls, [&](Nanoseconds<std::int64_t> now) { return bucket.try_acquire(now); });
+    }
+
+    const unsigned max_threads = std::max(2U, std::thread::hardware_concurrency());
+    for (unsigned threads = 1; threads <= max_threads; threads *= 2)
+    {
+        ConcurrentTokenBucket bucket{rate, 64};
+        run("ConcurrentTokenBucket", threads, calls,
+            [&](Nanoseconds<std::int64_t> now) { return bucket.try_acquire(now); });
+
+        std::mutex mutex;
+        TokenBucket guarded{rate, 64};
+        run("mutex + TokenBucket", threads, calls, [&](Nanoseconds<std::int64_t> now) {
+            const std::lock_guard lock{mutex};
+            return guarded.try_acquire(now);
+        });
+    }
+    return 0;
+}
+
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,211 @@
+// NOLINTBEGIN(readability-magic-numbers) — benchmark
+// Entity churn: SlotMap<Body, Tag> against std::unordered_map<std::uint64_t, Body> keyed by a
+// counter, which is what the simulation used before handles. Each phase is timed per operation.
+//
+//   slot_map_bench [entities] [rounds]   (default 100000 20)
+
+#include "strong-types/clock.hpp"
+#include "strong-types/slot_map.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+using namespace strong_types;
+
+namespace
+{
+
+struct Body
+{
+    double x = 0.0;
+    double y = 0.0;
+    double vx = 1.0;
+    double vy = 0.5;
+};
+
+struct BodyTag;
+using Bodies = SlotMap<Body, BodyTag>;
+using Handle = Bodies::handle_type;
+
+template <typename Round>
+void run(const char *label, std::size_t ops, int rounds, Round body)
+{
+    double sink = 0.0;
+    std::int64_t elapsed = 0;
+    for (int r = 0; r < rounds; ++r)
+    {
+        sink += body(elapsed);
+    }
+    std::printf("%-40s %8.2f ns/op   (checksum %.6g)\n", label,
+                static_cast<double>(elapsed) / (static_cast<double>(ops) * static_cast<double>(rounds)), sink);
+}
+
+/// Times `work` and adds the nanoseconds to `elapsed`
+template <typename Work>
+double timed(std::int64_t &elapsed, Work work)
+{
+    const auto begin = steady_now_ns().get();
+    const double result = work();
+    elapsed += steady_now_ns().get() - begin;
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const auto entities = static_cast<std::size_t>(argc > 1 ? std::atoll(argv[1]) : 100'000);
+    const int rounds = argc > 2 ? std::atoi(argv[2]) : 20;
+
+    std::vector<std::size_t> order(entities);
+    for (std::size_t i = 0; i < entities; ++i)
+    {
+        order[i] = i;
+    }
+    std::shuffle(order.begin(), order.end(), std::mt19937_64{42});
+
+    std::printf("insert\n");
+    run("  unordered_map<uint64_t, Body>", entities, rounds, [&](std::int64_t &elapsed) {
+        std::unordered_map<std::uint64_t, Body> map;
+        return timed(elapsed, [&] {
+            for (std::uint64_t i = 0; i < entities; ++i)
+            {
+                map.emplace(i, Body{});
+            }
+            return static_cast<double>(map.size());
+        });
+    });
+    run("  SlotMap<Body>", entities, rounds, [&](std::int64_t &elapsed) {
+        Bodies map;
+        return timed(elapsed, [&] {
+            for (std::size_t i = 0; i < entities; ++i)
+            {
+                map.emplace();
+            }
+            return static_cast<double>(map.size());
+        });
+    });
+
+    std::printf("random lookup\n");
+    {
+        std::unordered_map<std::uint64_t, Body> map;
+        for (std::uint64_t i = 0; i < entities; ++i)
+        {
+            map.emplace(i, Body{});
+        }
+        run("  unordered_map<uint64_t, Body>", entities, rounds, [&](std::int64_t &elapsed) {
+            return timed(elapsed, [&] {
+                double sum = 0.0;
+                for (const auto i : order)
+                {
+                    sum += map.find(i)->second.vx;
+                }
+                return sum;
+            });
+        });
+    }
+    {
+        Bodies map;
+        std::vector<Handle> handles;
+        handles.reserve(entities);
+        for (std::size_t i = 0; i < entities; ++i)
+        {
+            handles.push_back(map.emplace());
+        }
+        run("  SlotMap<Body>", entities, rounds, [&](std::int64_t &elapsed) {
+            return timed(elapsed, [&] {
+                double sum = 0.0;
+                for (const auto i : order)
+                {
+                    sum += map.find(handles[i])->vx;
+                }
+                return sum;
+            });
+        });
+    }
+
+    std::printf("erase half + reinsert (churn)\n");
+    run("  unordered_map<uint64_t, Body>", entities, rounds, [&](std::int64_t &elapsed) {
+        std::unordered_map<std::uint64_t, Body> map;
+        for (std::uint64_t i = 0; i < entities; ++i)
+        {
+            map.emplace(i, Body{});
+        }
+        return timed(elapsed, [&] {
+            std::uint64_t next = entities;
+            for (std::size_t k = 0; k < entities / 2; ++k)
+            {
+                map.erase(order[k]);
+            }
+            for (std::size_t k = 0; k < entities / 2; ++k)
+            {
+                map.emplace(next++, Body{});
+            }
+            return static_cast<double>(map.size());
+        });
+    });
+    run("  SlotMap<Body>", entities, rounds, [&](std::int64_t &elapsed) {
+        Bodies map;
+        std::vector<Handle> handles;
+        handles.reserve(entities);
+        for (std::size_t i = 0; i < entities; ++i)
+        {
+            handles.push_back(map.emplace());
+        }
+        return timed(elapsed, [&] {
+            for (std::size_t k = 0; k < entities / 2; ++k)
+            {
+                map.erase(handles[order[k]]);
+            }
+            for (std::size_t k = 0; k < entities / 2; ++k)
+            {
+                map.emplace();
+            }
+            return static_cast<double>(map.size());
+        });
+    });
+
+    std::printf("iterate all (integrate positions)\n");
+    {
+        std::unordered_map<std::uint64_t, Body> map;
+        for (std::uint64_t i = 0; i < entities; ++i)
+        {
+            map.emplace(i, Body{});
+        }
+        run("  unordered_map<uint64_t, Body>", entities, rounds, [&](std::int64_t &elapsed) {
+            return timed(elapsed, [&] {
+                for (auto &[id, body] : map)
+                {
+                    body.x += body.vx;
+                    body.y += body.vy;
+                }
+                return map.begin()->second.x;
+            });
+        });
+    }
+    {
+        Bodies map;
+        for (std::size_t i = 0; i < entities; ++i)
+        {
+            map.emplace();
+        }
+        run("  SlotMap<Body>", entities, rounds, [&](std::int64_t &elapsed) {
+            return timed(elapsed, [&] {
+                for (auto &body : map)
+                {
+                    body.x += body.vx;
+                    body.y += body.vy;
+                }
+                return map.values()[0].x;
+            });
+        });
+    }
+    return 0;
+}
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,92 @@
+// NOLINTBEGIN(readability-magic-numbers) — benchmark
+// One-field scans over track records: a std::vector of structs (AoS) against soa_vector (SoA).
+// The AoS loop drags every 32-byte record through the cache to read 8 bytes of it; the SoA loop
+// streams one aligned column, which the compiler vectorizes.
+//
+//   soa_vector_bench [elements] [rounds]   (default 1000000 200)
+
+#include "strong-types/clock.hpp"
+#include "strong-types/soa_vector.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace strong_types;
+
+namespace
+{
+
+using Meters = unit_t<double, LengthTag>;
+using Speed = unit_t<double, SpeedTag>;
+using Stamp = Nanoseconds<std::int64_t>;
+
+struct TrackRecord
+{
+    Stamp stamp;
+    Meters x;
+    Meters y;
+    Speed speed;
+};
+
+template <typename Body>
+void run(const char *label, std::size_t elements, int rounds, Body body)
+{
+    double sink = 0.0;
+    const auto begin = steady_now_ns().get();
+    for (int r = 0; r < rounds; ++r)
+    {
+        sink += body();
+    }
+    const auto elapsed_ns = static_cast<double>(steady_now_ns().get() - begin);
+    std::printf("%-36s %9.3f ns/element   (checksum %.6g)\n", label,
+                elapsed_ns / (static_cast<double>(elements) * static_cast<double>(rounds)), sink);
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const auto elements = static_cast<std::size_t>(argc > 1 ? std::atoll(argv[1]) : 1'000'000);
+    const int rounds = argc > 2 ? std::atoi(argv[2]) : 200;
+
+    std::vector<TrackRecord> aos;
+    soa_vector<Stamp, Meters, Meters, Speed> soa;
+    aos.reserve(elements);
+    soa.reserve(elements);
+    for (std::size_t i = 0; i < elements; ++i)
+    {
+        const auto stamp = Stamp{static_cast<std::int64_t>(i)};
+        const auto value = static_cast<double>(i % 97U);
+        aos.push_back({stamp, Meters{value}, Meters{-value}, Speed{value * 0.5}});
+        soa.push_back(stamp, Meters{value}, Meters{-value}, Speed{value * 0.5});
+    }
+
+    std::printf("sum of speed\n");
+    run("  AoS vector<TrackRecord>", elements, rounds, [&] {
+        Speed total{};
+        for (const auto &record : aos)
+        {
+            total += record.speed;
+        }
+        return total.get();
+    });
+    run("  soa_vector column<3>", elements, rounds, [&] { return sum(soa.column<3>()).get(); });
+
+    std::printf("scale x by 1.0001\n");
+    run("  AoS vector<TrackRecord>", elements, rounds, [&] {
+        for (auto &record : aos)
+        {
+            record.x *= 1.0001;
+        }
+        return aos[0].x.get();
+    });
+    run("  soa_vector scale<1>", elements, rounds, [&] {
+        soa.scale<1>(1.0001);
+        return soa.column<1>()[0].get();
+    });
+    return 0;
+}
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,228 @@
+// NOLINTBEGIN(readability-magic-numbers) — benchmark
+// Heavy Strong payloads: the cost of `acc += x` and of `a + b + c + d` when the value type is a
+// 4 KiB AlignedArray or a heap-backed matrix. The "copying" rows replay what the operators did
+// before in-place compound assignment and rvalue overloads (get() by value, `lhs = lhs + rhs`).
+//
+//   strong_move_bench [elements] [rounds]   (default 256 2000)
+
+#include "strong-types/aligned_array.hpp"
+#include "strong-types/clock.hpp"
+#include "strong-types/strong.hpp"
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <vector>
+
+struct BenchTag
+{
+};
+
+namespace strong_types
+{
+template <>
+struct tag_sum_result<BenchTag, BenchTag>
+{
+    using type = BenchTag;
+};
+template <>
+struct tag_difference_result<BenchTag, BenchTag>
+{
+    using type = BenchTag;
+};
+} // namespace strong_types
+
+using namespace strong_types;
+
+namespace
+{
+
+/// Element-wise matrix with heap storage, so every copy is an allocation plus a memcpy
+class Matrix
+{
+public:
+    static constexpr std::size_t DIM = 32;
+
+    Matrix() : data_(DIM * DIM)
+    {
+    }
+
+    explicit Matrix(double fill) : data_(DIM * DIM, fill)
+    {
+    }
+
+    [[nodiscard]] double trace() const noexcept
+    {
+        double sum = 0.0;
+        for (std::size_t i = 0; i < DIM; ++i)
+        {
+            sum += data_[i * DIM + i];
+        }
+        return sum;
+    }
+
+    Matrix &operator+=(const Matrix &rhs) noexcept
+    {
+        std::transform(data_.begin(), data_.end(), rhs.data_.begin(), data_.begin(), std::plus<>{});
+        return *this;
+    }
+
+    Matrix &operator-=(const Matrix &rhs) noexcept
+    {
+        std::transform(data_.begin(), data_.end(), rhs.data_.begin(), data_.begin(), std::minus<>{});
+        return *this;
+    }
+
+    friend Matrix operator+(const Matrix &lhs, const Matrix &rhs)
+    {
+        Matrix out{lhs};
+        out += rhs;
+        return out;
+    }
+
+    friend Matrix operator-(const Matrix &lhs, const Matrix &rhs)
+    {
+        Matrix out{lhs};
+        out -= rhs;
+        return out;
+    }
+
+    friend Matrix operator*(const Matrix &lhs, const Matrix &rhs)
+    {
+        Matrix out{lhs};
+        std::transform(out.data_.begin(), out.data_.end(), rhs.data_.begin(), out.data_.begin(), std::multiplies<>{});
+        return out;
+    }
+
+    friend Matrix operator/(const Matrix &lhs, const Matrix &rhs)
+    {
+        Matrix out{lhs};
+        std::transform(out.data_.begin(), out.data_.end(), rhs.data_.begin(), out.data_.begin(), std::divides<>{});
+        return out;
+    }
+
+    friend Matrix operator-(const Matrix &val)
+    {
+        Matrix out{val};
+        std::transform(out.data_.begin(), out.data_.end(), out.data_.begin(), std::negate<>{});
+        return out;
+    }
+
+    friend bool operator==(const Matrix &, const Matrix &) = default;
+    friend auto operator<=>(const Matrix &, const Matrix &) = default;
+
+private:
+    std::vector<double> data_;
+};
+
+using Array = AlignedArray<float, 1024>;
+using ArrayQ = Strong<Array, BenchTag>;
+using MatrixQ = Strong<Matrix, BenchTag>;
+
+/// The pre-move operators: get() returned a copy and the sum was built from those copies
+template <typename Q>
+Q copying_add(const Q &lhs, const Q &rhs)
+{
+    using T = typename Q::value_type;
+    return Q{T{lhs.get()} + T{rhs.get()}};
+}
+
+double checksum(const Array &array) noexcept
+{
+    return static_cast<double>(array[0]) + static_cast<double>(array[array.size() - 1]);
+}
+
+double checksum(const Matrix &matrix) noexcept
+{
+    return matrix.trace();
+}
+
+template <typename Body>
+void run(const char *label, std::size_t elements, int rounds, Body body)
+{
+    double sink = 0.0;
+    const auto begin = steady_now_ns().get();
+    for (int r = 0; r < rounds; ++r)
+    {
+        sink += body();
+    }
+    const auto elapsed_ns = static_cast<double>(steady_now_ns().get() - begin);
+    std::printf("%-36s %9.1f ns/op   (checksum %.6g)\n", label,
+                elapsed_ns / (static_cast<double>(elements) * static_cast<double>(rounds)), sink);
+}
+
+template <typename Q, typename Make>
+void bench_payload(const char *name, std::size_t elements, int rounds, Make make)
+{
+    std::vector<Q> values;
+    values.reserve(elements);
+    for (std::size_t i = 0; i < elements; ++i)
+    {
+        values.push_back(make(static_cast<double>(i % 7U)));
+    }
+
+    std::printf("%s (sizeof = %zu)\n", name, sizeof(Q));
+
+    run("  acc = acc + x (copying)", elements, rounds, [&] {
+        Q acc = make(0.0);
+        for (const auto &value : values)
+        {
+            acc = copying_add(acc, value);
+        }
+        return checksum(acc.get());
+    });
+
+    run("  acc += x (in place)", elements, rounds, [&] {
+        Q acc = make(0.0);
+        for (const auto &value : values)
+        {
+            acc += value;
+        }
+        return checksum(acc.get());
+    });
+
+    const std::size_t quads = elements / 4;
+    run("  a + b + c + d (copying)", quads * 4, rounds, [&] {
+        double sum = 0.0;
+        for (std::size_t i = 0; i + 3 < elements; i += 4)
+        {
+            const Q total =
+                copying_add(copying_add(copying_add(values[i], values[i + 1]), values[i + 2]), values[i + 3]);
+            sum += checksum(total.get());
+        }
+        return sum;
+    });
+
+    run("  a + b + c + d (rvalue reuse)", quads * 4, rounds, [&] {
+        double sum = 0.0;
+        for (std::size_t i = 0; i + 3 < elements; i += 4)
+        {
+            const Q total = values[i] + values[i + 1] + values[i + 2] + values[i + 3];
+            sum += checksum(total.get());
+        }
+        return sum;
+    });
+    std::printf("\n");
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const auto elements = static_cast<std::size_t>(argc > 1 ? std::atoll(argv[1]) : 256);
+    const int rounds = argc > 2 ? std::atoi(argv[2]) : 2000;
+
+    bench_payload<ArrayQ>("Strong<AlignedArray<float, 1024>>", elements, rounds, [](double fill) {
+        Array array{};
+        std::fill(array.begin(), array.end(), static_cast<float>(fill));
+        return ArrayQ{array};
+    });
+
+    bench_payload<MatrixQ>("Strong<Matrix 32x32, heap>", elements, rounds,
+                           [](double fill) { return MatrixQ{Matrix{fill}}; });
+    return 0;
+}
+// NOLINTEND(readability-magic-numbers)
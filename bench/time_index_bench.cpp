@@ -0,0 +1,96 @@
+// NOLINTBEGIN(readability-magic-numbers) — benchmark
+// Lower-bound lookups of random timestamps in a sorted SteadyTimePoint<int64_t> column: std::lower_bound
+// against TimeIndex single queries and 8-way batched queries. The column is large enough that most
+// probes miss cache.
+//
+//   time_index_bench [elements] [queries]   (default 16000000 4000000)
+
+#include "strong-types/clock.hpp"
+#include "strong-types/time_index.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace strong_types;
+
+namespace
+{
+
+using Stamp = SteadyTimePoint<std::int64_t>;
+
+template <typename Lookup>
+void run(const char *label, const std::vector<Stamp> &queries, std::vector<std::size_t> &out, Lookup lookup)
+{
+    const auto begin = steady_now_ns().get();
+    lookup(out);
+    const auto elapsed = steady_now_ns().get() - begin;
+    std::size_t checksum = 0;
+    for (const auto position : out)
+    {
+        checksum += position;
+    }
+    std::printf("%-26s %8.2f Mq/s   %6.1f ns/query   (checksum %zu)\n", label,
+                static_cast<double>(queries.size()) * 1e3 / static_cast<double>(elapsed),
+                static_cast<double>(elapsed) / static_cast<double>(queries.size()), checksum);
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const auto elements = static_cast<std::size_t>(argc > 1 ? std::atoll(argv[1]) : 16'000'000);
+    const auto query_count = static_cast<std::size_t>(argc > 2 ? std::atoll(argv[2]) : 4'000'000);
+
+    std::mt19937_64 rng{13};
+    std::uniform_int_distribution<std::int64_t> step{1, 1'000};
+    std::vector<Stamp> stamps;
+    stamps.reserve(elements);
+    std::int64_t now = 0;
+    for (std::size_t i = 0; i < elements; ++i)
+    {
+        now += step(rng);
+        stamps.emplace_back(now);
+    }
+
+    std::uniform_int_distribution<std::int64_t> anywhere{0, now};
+    std::vector<Stamp> queries;
+    queries.reserve(query_count);
+    for (std::size_t i = 0; i < query_count; ++i)
+    {
+        queries.emplace_back(anywhere(rng));
+    }
+
+    const auto build_begin = steady_now_ns().get();
+    const auto index = TimeIndex<Stamp>::create(stamps);
+    std::printf("%zu timestamps, %zu queries, index built in %.1f ms\n", elements, query_count,
+                static_cast<double>(steady_now_ns().get() - build_begin) / 1e6);
+    if (!index)
+    {
+        return 1;
+    }
+
+    std::vector<std::size_t> out(query_count);
+    run("std::lower_bound", queries, out, [&](std::vector<std::size_t> &result) {
+        for (std::size_t i = 0; i < queries.size(); ++i)
+        {
+            result[i] = static_cast<std::size_t>(std::lower_bound(stamps.begin(), stamps.end(), queries[i]) -
+                                                 stamps.begin());
+        }
+    });
+    run("TimeIndex::lower_bound", queries, out, [&](std::vector<std::size_t> &result) {
+        for (std::size_t i = 0; i < queries.size(); ++i)
+        {
+            result[i] = index->lower_bound(queries[i]);
+        }
+    });
+    run("TimeIndex batch", queries, out, [&](std::vector<std::size_t> &result) {
+        (void)index->lower_bound(queries, result);
+    });
+    return 0;
+}
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,99 @@
+// NOLINTBEGIN(readability-magic-numbers) — benchmark
+// Recording (SteadyTimePoint<int64_t>, unit_t<double, LengthTag>) samples: a growing std::vector of pairs
+// against TimeSeries. Reports mean and worst single-append latency, where the vector's worst case is a
+// reallocation copying everything recorded so far. Then sums random 10% time windows by scanning the
+// vector, and through TimeSeries, which uses per-chunk summaries.
+//
+//   time_series_bench [samples] [windows]   (default 16000000 200)
+
+#include "strong-types/clock.hpp"
+#include "strong-types/si.hpp"
+#include "strong-types/time_series.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace strong_types;
+
+namespace
+{
+
+using Stamp = SteadyTimePoint<std::int64_t>;
+using Depth = unit_t<double, LengthTag>;
+
+template <typename Append>
+void run_append(const char *label, std::size_t samples, Append append)
+{
+    std::int64_t worst = 0;
+    const auto begin = steady_now_ns().get();
+    for (std::size_t i = 0; i < samples; ++i)
+    {
+        const auto before = steady_now_ns().get();
+        append(Stamp{static_cast<std::int64_t>(i) * 100}, Depth{static_cast<double>(i % 1000)});
+        worst = std::max(worst, steady_now_ns().get() - before);
+    }
+    const auto elapsed = steady_now_ns().get() - begin;
+    std::printf("%-30s %6.1f ns/append (incl. clock reads)   worst %9.1f us\n", label,
+                static_cast<double>(elapsed) / static_cast<double>(samples), static_cast<double>(worst) / 1e3);
+}
+
+template <typename Sum>
+void run_windows(const char *label, const std::vector<std::pair<Stamp, Stamp>> &windows, Sum sum)
+{
+    double checksum = 0.0;
+    const auto begin = steady_now_ns().get();
+    for (const auto &[from, to] : windows)
+    {
+        checksum += sum(from, to);
+    }
+    const auto elapsed = steady_now_ns().get() - begin;
+    std::printf("%-30s %9.1f us/window   (checksum %.0f)\n", label,
+                static_cast<double>(elapsed) / 1e3 / static_cast<double>(windows.size()), checksum);
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const auto samples = static_cast<std::size_t>(argc > 1 ? std::atoll(argv[1]) : 16'000'000);
+    const auto window_count = static_cast<std::size_t>(argc > 2 ? std::atoll(argv[2]) : 200);
+    std::printf("%zu samples\n", samples);
+
+    std::vector<std::pair<Stamp, Depth>> vector;
+    run_append("std::vector::push_back", samples,
+               [&vector](Stamp t, Depth d) { vector.emplace_back(t, d); });
+
+    TimeSeries<Stamp, Depth> series;
+    run_append("TimeSeries::append", samples, [&series](Stamp t, Depth d) { (void)series.append(t, d); });
+
+    std::mt19937_64 rng{17};
+    const auto span = static_cast<std::int64_t>(samples) * 100;
+    std::uniform_int_distribution<std::int64_t> start{0, span - span / 10};
+    std::vector<std::pair<Stamp, Stamp>> windows;
+    for (std::size_t i = 0; i < window_count; ++i)
+    {
+        const auto from = start(rng);
+        windows.emplace_back(Stamp{from}, Stamp{from + span / 10});
+    }
+
+    std::printf("\n");
+    run_windows("vector scan", windows, [&vector](Stamp from, Stamp to) {
+        const auto first = std::lower_bound(vector.begin(), vector.end(), from,
+                                            [](const auto &sample, Stamp t) { return sample.first < t; });
+        double total = 0.0;
+        for (auto it = first; it != vector.end() && it->first < to; ++it)
+        {
+            total += it->second.get();
+        }
+        return total;
+    });
+    run_windows("TimeSeries::sum", windows, [&series](Stamp from, Stamp to) { return series.sum(from, to).get(); });
+    return 0;
+}
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,505 @@
+#pragma once
+
+#include "dimension.hpp"
+#include "safe_math.hpp"
+#include "si.hpp"
+#include "si_scaled.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <expected>
+#include <limits>
+#include <optional>
+#include <ratio>
+#include <type_traits>
+#include <utility>
+
+namespace strong_types
+{
+
+// ---- AnyQuantity: a quantity whose dimension is known only at run time ----
+//
+// 24 bytes, no heap: the value (an int64 for integral reps, else a double), its scale to SI base
+// units (cached num/den, negated to mark an integral payload) and the dimension packed as eight
+// signed exponent bytes in one integer. Same-dimension checks are a single integer compare.
+// Products and quotients add or subtract the exponent bytes in one SWAR step. A cast back to a
+// typed quantity whose dimension and scale both match returns the stored value without arithmetic;
+// otherwise the value is rescaled by one stored-to-target factor. Integral payloads stay exact
+// through whole-factor rescaling, sums and products until a result leaves int64, then fall back
+// to double.
+
+enum class AnyQuantityErrc
+{
+    dimension_mismatch,
+    out_of_range ///< the value does not fit the integral target type
+};
+
+namespace detail
+{
+
+/// Dimension<...> equivalent of a tag; the named SI tags map to their dim:: counterparts
+template <typename Tag>
+struct tag_dimension
+{
+};
+
+template <int... E>
+struct tag_dimension<Dimension<E...>>
+{
+    using type = Dimension<E...>;
+};
+
+template <>
+struct tag_dimension<void>
+{
+    using type = Dimensionless;
+};
+
+#if !STRONG_TYPES_DIMENSION_ENGINE
+// With the dimension engine enabled these tags already are Dimension types
+template <>
+struct tag_dimension<LengthTag>
+{
+    using type = dim::Length;
+};
+template <>
+struct tag_dimension<MassTag>
+{
+    using type = dim::Mass;
+};
+template <>
+struct tag_dimension<TimeTag>
+{
+    using type = dim::Time;
+};
+template <>
+struct tag_dimension<AreaTag>
+{
+    using type = dim::Area;
+};
+template <>
+struct tag_dimension<SpeedTag>
+{
+    using type = dim::Speed;
+};
+template <>
+struct tag_dimension<AccelerationTag>
+{
+    using type = dim::Acceleration;
+};
+template <>
+struct tag_dimension<ForceTag>
+{
+    using type = dim::Force;
+};
+template <>
+struct tag_dimension<EnergyTag>
+{
+    using type = dim::Energy;
+};
+template <>
+struct tag_dimension<HertzTag>
+{
+    using type = dim::Frequency;
+};
+template <>
+struct tag_dimension<CelsiusTag>
+{
+    using type = dim::Temperature;
+};
+template <>
+struct tag_dimension<VoltTag>
+{
+    using type = dim::Voltage;
+};
+template <>
+struct tag_dimension<RadianTag>
+{
+    using type = dim::Angle;
+};
+template <>
+struct tag_dimension<SteradianTag>
+{
+    using type = dim::SolidAngle;
+};
+template <>
+struct tag_dimension<PowerTag>
+{
+    using type = dim::Power;
+};
+template <>
+struct tag_dimension<PressureTag>
+{
+    using type = dim::Pressure;
+};
+template <>
+struct tag_dimension<AngularVelocityTag>
+{
+    using type = dim::AngularVelocity;
+};
+template <>
+struct tag_dimension<VolumeTag>
+{
+    using type = dim::Volume;
+};
+template <>
+struct tag_dimension<DensityTag>
+{
+    using type = dim::Density;
+};
+template <>
+struct tag_dimension<TorqueTag>
+{
+    using type = dim::Torque;
+};
+#endif
+
+[[nodiscard]] constexpr std::uint64_t pack_exponent(int exponent, int lane) noexcept
+{
+    return std::uint64_t{static_cast<std::uint8_t>(static_cast<std::int8_t>(exponent))} << (8 * lane);
+}
+
+template <typename D>
+[[nodiscard]] consteval std::uint64_t pack_dimension() noexcept
+{
+    return pack_exponent(D::length, 0) | pack_exponent(D::mass, 1) | pack_exponent(D::time, 2) |
+           pack_exponent(D::current, 3) | pack_exponent(D::temperature, 4) | pack_exponent(D::amount, 5) |
+           pack_exponent(D::luminosity, 6) | pack_exponent(D::angle, 7);
+}
+
+inline constexpr std::uint64_t LANE_HIGH = 0x8080808080808080ULL;
+
+/// Byte-wise a + b with no carry between lanes
+[[nodiscard]] constexpr std::uint64_t add_exponents(std::uint64_t lhs, std::uint64_t rhs) noexcept
+{
+    return ((lhs & ~LANE_HIGH) + (rhs & ~LANE_HIGH)) ^ ((lhs ^ rhs) & LANE_HIGH);
+}
+
+/// Byte-wise a - b with no borrow between lanes
+[[nodiscard]] constexpr std::uint64_t sub_exponents(std::uint64_t lhs, std::uint64_t rhs) noexcept
+{
+    return ((lhs | LANE_HIGH) - (rhs & ~LANE_HIGH)) ^ ((lhs ^ ~rhs) & LANE_HIGH);
+}
+
+template <typename Q>
+struct any_quantity_traits;
+
+template <typename T, typename Tag>
+struct any_quantity_traits<unit_t<T, Tag>>
+{
+    using tag = Tag;
+    using ratio = std::ratio<1>;
+};
+
+template <typename T, typename Tag, typename R>
+struct any_quantity_traits<ScaledUnit<T, Tag, R>>
+{
+    using tag = Tag;
+    using ratio = R;
+};
+
+/// Reps AnyQuantity stores without rounding: floating point, or integers that fit in int64
+template <typename T>
+concept AnyQuantityRep =
+    std::floating_point<T> || (std::integral<T> && std::cmp_less_equal(std::numeric_limits<T>::max(),
+                                                                       std::numeric_limits<std::int64_t>::max()));
+
+/// 2^53: every integer of smaller magnitude is exact in a double
+inline constexpr double DOUBLE_EXACT_LIMIT = 9007199254740992.0;
+
+/// Whether static_cast<T>(value) is defined, i.e. value truncated toward zero lies in T's range
+template <std::integral T>
+[[nodiscard]] constexpr bool truncates_into(double value) noexcept
+{
+    // 2^digits is exact in a double, unlike max() for 64-bit T
+    constexpr double upper = static_cast<double>((std::numeric_limits<T>::max() / 2) + 1) * 2.0;
+    if constexpr (std::is_signed_v<T>)
+    {
+        return value >= -upper && value < upper;
+    }
+    else
+    {
+        return value > -1.0 && value < upper;
+    }
+}
+
+} // namespace detail
+
+/// unit_t or ScaledUnit whose tag has a Dimension equivalent
+template <typename Q>
+concept AnyQuantityConvertible = requires {
+    typename detail::tag_dimension<typename detail::any_quantity_traits<Q>::tag>::type;
+};
+
+/// Packed exponents of a tag, as stored by AnyQuantity
+template <typename Tag>
+inline constexpr std::uint64_t dimension_code_v = detail::pack_dimension<typename detail::tag_dimension<Tag>::type>();
+
+class AnyQuantity
+{
+public:
+    constexpr AnyQuantity() noexcept = default;
+
+    /// Integral values are stored as int64 and floating-point ones as double. A rep whose values do
+    /// not all fit in int64 (std::uint64_t) is rejected rather than rounded.
+    template <typename Q>
+        requires AnyQuantityConvertible<Q> && detail::AnyQuantityRep<typename Q::value_type>
+    constexpr explicit AnyQuantity(const Q &quantity) noexcept
+        : AnyQuantity(encode(quantity.get()), stored_scale<Q>(),
+                      dimension_code_v<typename detail::any_quantity_traits<Q>::tag>)
+    {
+    }
+
+    /// True when the value is held exactly as an int64
+    [[nodiscard]] constexpr bool is_integral() const noexcept
+    {
+        return scale_ < 0.0;
+    }
+
+    /// Value in the stored scale; an integral payload is converted to double
+    [[nodiscard]] constexpr double value() const noexcept
+    {
+        return is_integral() ? static_cast<double>(payload_) : std::bit_cast<double>(payload_);
+    }
+
+    /// Multiplier from the stored scale to SI base units
+    [[nodiscard]] constexpr double scale() const noexcept
+    {
+        return is_integral() ? -scale_ : scale_;
+    }
+
+    [[nodiscard]] constexpr std::uint64_t dimension_code() const noexcept
+    {
+        return dimension_;
+    }
+
+    /// Exponent of base dimension `lane` (0 length, 1 mass, 2 time, ... 7 angle)
+    [[nodiscard]] constexpr int exponent(int lane) const noexcept
+    {
+        return static_cast<std::int8_t>(static_cast<std::uint8_t>(dimension_ >> (8 * lane)));
+    }
+
+    [[nodiscard]] constexpr double to_base_value() const noexcept
+    {
+        return value() * scale();
+    }
+
+    /// True when `Q` has the same dimension and scale, i.e. as<Q>() needs no rescaling
+    template <typename Q>
+        requires AnyQuantityConvertible<Q>
+    [[nodiscard]] constexpr bool holds() const noexcept
+    {
+        return dimension_ == dimension_code_v<typename detail::any_quantity_traits<Q>::tag> && scale() == scale_of<Q>();
+    }
+
+    template <typename Q>
+        requires AnyQuantityConvertible<Q>
+    [[nodiscard]] constexpr bool same_dimension() const noexcept
+    {
+        return dimension_ == dimension_code_v<typename detail::any_quantity_traits<Q>::tag>;
+    }
+
+    /// Checked cast to unit_t / ScaledUnit. An integral payload rescaled by a whole factor stays exact;
+    /// a value outside the range of an integral target fails with out_of_range instead of wrapping.
+    template <typename Q>
+        requires AnyQuantityConvertible<Q>
+    [[nodiscard]] constexpr std::expected<Q, AnyQuantityErrc> as() const noexcept
+    {
+        using T = typename Q::value_type;
+        if (!same_dimension<Q>())
+        {
+            return std::unexpected(AnyQuantityErrc::dimension_mismatch);
+        }
+        if constexpr (std::is_integral_v<T>)
+        {
+            if (const auto exact = integer_at(scale_of<Q>()))
+            {
+                if (!std::in_range<T>(*exact))
+                {
+                    return std::unexpected(AnyQuantityErrc::out_of_range);
+                }
+                return Q{static_cast<T>(*exact)};
+            }
+        }
+        const double val = scale() == scale_of<Q>() ? value() : value() * (scale() / scale_of<Q>());
+        if constexpr (std::is_integral_v<T>)
+        {
+            if (!detail::truncates_into<T>(val))
+            {
+                return std::unexpected(AnyQuantityErrc::out_of_range);
+            }
+        }
+        return Q{static_cast<T>(val)};
+    }
+
+    // ---- checked arithmetic ----
+
+    /// Sum in the finer of the two scales; exact when both payloads are integral and it fits in int64
+    [[nodiscard]] constexpr std::expected<AnyQuantity, AnyQuantityErrc> plus(const AnyQuantity &rhs) const noexcept
+    {
+        return combine(rhs, false);
+    }
+
+    [[nodiscard]] constexpr std::expected<AnyQuantity, AnyQuantityErrc> minus(const AnyQuantity &rhs) const noexcept
+    {
+        return combine(rhs, true);
+    }
+
+    [[nodiscard]] friend constexpr AnyQuantity operator*(const AnyQuantity &lhs, const AnyQuantity &rhs) noexcept
+    {
+        const auto dimension = detail::add_exponents(lhs.dimension_, rhs.dimension_);
+        const auto scale = lhs.scale() * rhs.scale();
+        if (lhs.is_integral() && rhs.is_integral())
+        {
+            if (const auto product = safe_multiply(lhs.payload_, rhs.payload_))
+            {
+                return integer(*product, scale, dimension);
+            }
+        }
+        return real(lhs.value() * rhs.value(), scale, dimension);
+    }
+
+    [[nodiscard]] friend constexpr AnyQuantity operator/(const AnyQuantity &lhs, const AnyQuantity &rhs) noexcept
+    {
+        return real(lhs.value() / rhs.value(), lhs.scale() / rhs.scale(),
+                    detail::sub_exponents(lhs.dimension_, rhs.dimension_));
+    }
+
+    [[nodiscard]] friend constexpr AnyQuantity operator*(const AnyQuantity &lhs, double scalar) noexcept
+    {
+        return real(lhs.value() * scalar, lhs.scale(), lhs.dimension_);
+    }
+
+    [[nodiscard]] friend constexpr AnyQuantity operator*(double scalar, const AnyQuantity &rhs) noexcept
+    {
+        return rhs * scalar;
+    }
+
+    [[nodiscard]] friend constexpr AnyQuantity operator/(const AnyQuantity &lhs, double scalar) noexcept
+    {
+        return real(lhs.value() / scalar, lhs.scale(), lhs.dimension_);
+    }
+
+    [[nodiscard]] friend constexpr AnyQuantity operator-(const AnyQuantity &val) noexcept
+    {
+        if (val.is_integral() && val.payload_ != std::numeric_limits<std::int64_t>::min())
+        {
+            return integer(-val.payload_, val.scale(), val.dimension_);
+        }
+        return real(-val.value(), val.scale(), val.dimension_);
+    }
+
+    /// Exact representation equality (payload kind and bits, scale and dimension)
+    [[nodiscard]] bool operator==(const AnyQuantity &) const = default;
+
+private:
+    constexpr AnyQuantity(std::int64_t payload, double scale, std::uint64_t dimension) noexcept
+        : payload_(payload), scale_(scale), dimension_(dimension)
+    {
+    }
+
+    [[nodiscard]] static constexpr AnyQuantity integer(std::int64_t value, double scale,
+                                                       std::uint64_t dimension) noexcept
+    {
+        return AnyQuantity{value, -scale, dimension};
+    }
+
+    [[nodiscard]] static constexpr AnyQuantity real(double value, double scale, std::uint64_t dimension) noexcept
+    {
+        return AnyQuantity{std::bit_cast<std::int64_t>(value), scale, dimension};
+    }
+
+    template <typename T>
+    [[nodiscard]] static constexpr std::int64_t encode(T value) noexcept
+    {
+        if constexpr (std::is_integral_v<T>)
+        {
+            return static_cast<std::int64_t>(value);
+        }
+        else
+        {
+            return std::bit_cast<std::int64_t>(static_cast<double>(value));
+        }
+    }
+
+    template <typename Q>
+    [[nodiscard]] static consteval double scale_of() noexcept
+    {
+        using R = typename detail::any_quantity_traits<Q>::ratio;
+        return static_cast<double>(R::num) / static_cast<double>(R::den);
+    }
+
+    template <typename Q>
+    [[nodiscard]] static consteval double stored_scale() noexcept
+    {
+        return std::is_integral_v<typename Q::value_type> ? -scale_of<Q>() : scale_of<Q>();
+    }
+
+    /// The integral payload at `target` scale when the factor between the scales is whole: multiplied
+    /// exactly, or divided with truncation toward zero. nullopt for a real payload, a fractional
+    /// factor or an int64 overflow.
+    [[nodiscard]] constexpr std::optional<std::int64_t> integer_at(double target) const noexcept
+    {
+        if (!is_integral())
+        {
+            return std::nullopt;
+        }
+        const double stored = scale();
+        if (stored == target)
+        {
+            return payload_;
+        }
+        const double factor = stored > target ? stored / target : target / stored;
+        if (!(factor < detail::DOUBLE_EXACT_LIMIT) || static_cast<double>(static_cast<std::int64_t>(factor)) != factor)
+        {
+            return std::nullopt;
+        }
+        const auto whole = static_cast<std::int64_t>(factor);
+        if (stored < target)
+        {
+            return payload_ / whole;
+        }
+        const auto product = safe_multiply(payload_, whole);
+        return product ? std::optional<std::int64_t>{*product} : std::nullopt;
+    }
+
+    [[nodiscard]] constexpr std::expected<AnyQuantity, AnyQuantityErrc> combine(const AnyQuantity &rhs,
+                                                                               bool subtract) const noexcept
+    {
+        if (dimension_ != rhs.dimension_)
+        {
+            return std::unexpected(AnyQuantityErrc::dimension_mismatch);
+        }
+        const double finer = std::min(scale(), rhs.scale());
+        const auto lhs_int = integer_at(finer);
+        const auto rhs_int = rhs.integer_at(finer);
+        if (lhs_int && rhs_int)
+        {
+            const auto sum = subtract ? safe_subtract(*lhs_int, *rhs_int) : safe_add(*lhs_int, *rhs_int);
+            if (sum)
+            {
+                return integer(*sum, finer, dimension_);
+            }
+        }
+        const double sign = subtract ? -1.0 : 1.0;
+        if (scale() == rhs.scale())
+        {
+            return real(value() + sign * rhs.value(), finer, dimension_);
+        }
+        if (scale() < rhs.scale())
+        {
+            return real(value() + sign * rhs.value() * (rhs.scale() / scale()), finer, dimension_);
+        }
+        return real(value() * (scale() / rhs.scale()) + sign * rhs.value(), finer, dimension_);
+    }
+
+    std::int64_t payload_{};    // the value for an integral payload, else the bits of a double
+    double scale_{1.0};         // negated for an integral payload; every unit scale is positive
+    std::uint64_t dimension_{};
+};
+
+static_assert(sizeof(AnyQuantity) == 24);
+
+} // namespace strong_types
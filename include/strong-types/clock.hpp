@@ -0,0 +1,173 @@
+#pragma once
+
+#include "quantity_point.hpp"
+#include "si_chrono.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <expected>
+#include <limits>
+#include <string_view>
+#include <thread>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <time.h> // NOLINT(modernize-deprecated-headers) — clock_nanosleep is POSIX, not in <ctime>
+#define STRONG_TYPES_HAS_CLOCK_NANOSLEEP 1
+#else
+#define STRONG_TYPES_HAS_CLOCK_NANOSLEEP 0
+#endif
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#define STRONG_TYPES_HAS_MM_PAUSE 1
+#else
+#define STRONG_TYPES_HAS_MM_PAUSE 0
+#endif
+
+namespace strong_types
+{
+
+// ---- steady clock origin: epoch of std::chrono::steady_clock (CLOCK_MONOTONIC on Linux) ----
+
+struct SteadyClockOrigin
+{
+    static constexpr std::string_view name = "steady_clock"; ///< feeds origin_id_v
+};
+
+template <typename T = double>
+using SteadyTimePoint = QuantityPoint<T, TimeTag, SteadyClockOrigin>;
+
+// ---- time_since_origin: QuantityPoint<T, TimeTag, Origin> → Nanoseconds<int64_t> ----
+
+template <typename T, typename Origin>
+[[nodiscard]] constexpr Nanoseconds<std::int64_t> time_since_origin(QuantityPoint<T, TimeTag, Origin> pt) noexcept
+{
+    return to_nanoseconds(pt - QuantityPoint<T, TimeTag, Origin>{});
+}
+
+// ---- to_steady_point: Nanoseconds since the steady epoch → SteadyTimePoint<double> ----
+
+[[nodiscard]] constexpr SteadyTimePoint<double> to_steady_point(Nanoseconds<std::int64_t> since_epoch) noexcept
+{
+    return SteadyTimePoint<double>{static_cast<double>(since_epoch.get()) / 1'000'000'000.0};
+}
+
+// ---- from_time_point: steady_clock::time_point → SteadyTimePoint<double> ----
+
+template <typename Duration>
+[[nodiscard]] constexpr SteadyTimePoint<double>
+from_time_point(std::chrono::time_point<std::chrono::steady_clock, Duration> tp) noexcept
+{
+    return SteadyTimePoint<double>{from_chrono(tp.time_since_epoch()).get()};
+}
+
+// ---- to_time_point: SteadyTimePoint<T> → steady_clock::time_point ----
+
+template <typename T>
+[[nodiscard]] constexpr std::chrono::steady_clock::time_point to_time_point(SteadyTimePoint<T> pt) noexcept
+{
+    const std::chrono::nanoseconds::rep ns = time_since_origin(pt).get();
+    return std::chrono::steady_clock::time_point{
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::nanoseconds{ns})};
+}
+
+// ---- period_from_rate: HertzTag rate → whole-nanosecond period ----
+
+enum class PeriodErrc
+{
+    not_positive, ///< rate or period <= 0 (or NaN)
+    out_of_range  ///< period does not fit in int64 nanoseconds
+};
+
+/// Nearest whole nanosecond, at least 1 ns
+template <typename T>
+[[nodiscard]] constexpr std::expected<Nanoseconds<std::int64_t>, PeriodErrc>
+period_from_rate(unit_t<T, HertzTag> rate) noexcept
+{
+    const auto hz = static_cast<double>(rate.get());
+    if (!(hz > 0.0))
+    {
+        return std::unexpected(PeriodErrc::not_positive);
+    }
+    const double ns = 1'000'000'000.0 / hz + 0.5;
+    if (!(ns < static_cast<double>(std::numeric_limits<std::int64_t>::max())))
+    {
+        return std::unexpected(PeriodErrc::out_of_range);
+    }
+    return Nanoseconds<std::int64_t>{std::max(static_cast<std::int64_t>(ns), std::int64_t{1})};
+}
+
+namespace detail
+{
+
+/// Constructor fallback: an invalid period or rate becomes 1 ns rather than a division by zero.
+/// The create() factories reject it instead.
+[[nodiscard]] constexpr std::int64_t period_or_min(std::expected<Nanoseconds<std::int64_t>, PeriodErrc> period) noexcept
+{
+    return period ? std::max(period->get(), std::int64_t{1}) : std::int64_t{1};
+}
+
+} // namespace detail
+
+// ---- steady_now_ns / steady_now: read the steady clock ----
+
+[[nodiscard]] inline Nanoseconds<std::int64_t> steady_now_ns() noexcept
+{
+    const std::int64_t ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    return Nanoseconds<std::int64_t>{ns};
+}
+
+[[nodiscard]] inline SteadyTimePoint<double> steady_now() noexcept
+{
+    return to_steady_point(steady_now_ns());
+}
+
+// ---- cpu_relax: spin-wait hint ----
+
+inline void cpu_relax() noexcept
+{
+#if STRONG_TYPES_HAS_MM_PAUSE
+    _mm_pause();
+#endif
+}
+
+// ---- sleep_until_ns: absolute sleep on the steady clock ----
+
+inline void sleep_until_ns(Nanoseconds<std::int64_t> since_epoch) noexcept
+{
+#if STRONG_TYPES_HAS_CLOCK_NANOSLEEP
+    constexpr std::int64_t ns_per_s = 1'000'000'000;
+    struct timespec ts{};
+    ts.tv_sec = since_epoch.get() / ns_per_s;
+    ts.tv_nsec = since_epoch.get() % ns_per_s;
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR)
+    {
+    }
+#else
+    std::this_thread::sleep_until(to_time_point(to_steady_point(since_epoch)));
+#endif
+}
+
+// ---- spin_until_ns: busy-wait on the steady clock (sub-scheduler-quantum precision) ----
+
+inline void spin_until_ns(Nanoseconds<std::int64_t> since_epoch) noexcept
+{
+    while (steady_now_ns().get() < since_epoch.get())
+    {
+        cpu_relax();
+    }
+}
+
+// ---- sleep_until: SteadyTimePoint<T> ----
+
+template <typename T>
+inline void sleep_until(SteadyTimePoint<T> deadline) noexcept
+{
+    sleep_until_ns(time_since_origin(deadline));
+}
+
+} // namespace strong_types
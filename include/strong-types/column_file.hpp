@@ -0,0 +1,313 @@
+#pragma once
+
+#include "stable_id.hpp"
+#include "unit_span.hpp"
+
+#include <array>
+#include <cerrno>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <expected>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#if __has_include(<sys/mman.h>) && __has_include(<sys/stat.h>) && __has_include(<fcntl.h>) &&                      \
+    __has_include(<unistd.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define STRONG_TYPES_HAS_MMAP 1
+#else
+#define STRONG_TYPES_HAS_MMAP 0
+#endif
+
+#if STRONG_TYPES_HAS_MMAP
+
+namespace strong_types
+{
+
+// ---- Typed column files ----
+//
+// Loading a large unit array with fread copies every byte into a fresh vector before the first read.
+// A column file is a 64-byte ColumnFileHeader followed by the raw values. The header holds the
+// stable tag ID, the ratio, the origin ID, an element-type code and the count. MappedColumn<Q>
+// maps the file read-only and checks the header against Q once, at open. The values are then
+// read in place as a QuantitySpan, and pages are loaded on first touch. Values are stored in host
+// byte order, and a file from a host of the other byte order fails the magic check. Writes replace
+// the file by rename, so a live mapping of the previous version is never truncated under its reader.
+//
+//   write_column("depth.col", std::span<const Millimeters<double>>{depths});
+//   auto column = MappedColumn<Millimeters<double>>::open("depth.col");   // ColumnErrc::unit_mismatch if
+//   auto total = sum(column->view());                                      // the file holds metres
+
+enum class ColumnErrc
+{
+    open_failed,
+    write_failed,
+    map_failed,
+    bad_header,
+    truncated,
+    unit_mismatch,
+    type_mismatch
+};
+
+inline constexpr std::uint64_t COLUMN_FILE_MAGIC = 0x4C4F435453475453ULL; // "STGSTCOL" read little-endian
+inline constexpr std::uint32_t COLUMN_FILE_VERSION = 1;
+
+/// Values start here, so a page-aligned mapping puts them on a 64-byte boundary
+inline constexpr std::uint32_t COLUMN_DATA_OFFSET = 64;
+
+struct ColumnFileHeader
+{
+    std::uint64_t magic = COLUMN_FILE_MAGIC;
+    std::uint32_t version = COLUMN_FILE_VERSION;
+    std::uint32_t data_offset = COLUMN_DATA_OFFSET;
+    StableId tag_id = 0;
+    std::int64_t ratio_num = 1;
+    std::int64_t ratio_den = 1;
+    StableId origin_id = 0;
+    std::uint32_t element_code = 0;
+    std::uint32_t reserved = 0;
+    std::uint64_t count = 0;
+};
+
+static_assert(sizeof(ColumnFileHeader) == COLUMN_DATA_OFFSET && std::is_trivially_copyable_v<ColumnFileHeader>);
+
+/// Quantities a column file can hold: unit_t, ScaledUnit or QuantityPoint over an arithmetic type
+template <typename Q>
+concept ColumnQuantity = ValueLayout<Q> && std::is_arithmetic_v<typename Q::value_type> &&
+                         requires { typename detail::quantity_parts<Q>::tag; };
+
+/// 'f' / 'i' / 'u' in the high byte, sizeof in the low byte: 0x6608 is a double
+template <typename T>
+    requires std::is_arithmetic_v<T>
+inline constexpr std::uint32_t element_code_v =
+    (std::uint32_t{std::is_floating_point_v<T> ? 'f' : (std::is_signed_v<T> ? 'i' : 'u')} << 8U) |
+    std::uint32_t{sizeof(T)};
+
+template <ColumnQuantity Q>
+[[nodiscard]] constexpr ColumnFileHeader column_header_for(std::uint64_t count) noexcept
+{
+    using Parts = detail::quantity_parts<Q>;
+    ColumnFileHeader header;
+    header.tag_id = tag_id_v<typename Parts::tag>;
+    header.ratio_num = static_cast<std::int64_t>(Parts::ratio::num);
+    header.ratio_den = static_cast<std::int64_t>(Parts::ratio::den);
+    header.origin_id = origin_id_v<typename Parts::origin>;
+    header.element_code = element_code_v<typename Q::value_type>;
+    header.count = count;
+    return header;
+}
+
+namespace detail
+{
+
+[[nodiscard]] inline bool write_all(int fd, const void *data, std::size_t bytes) noexcept
+{
+    const auto *cursor = static_cast<const std::byte *>(data);
+    while (bytes != 0)
+    {
+        const ::ssize_t written = ::write(fd, cursor, bytes);
+        if (written < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (written <= 0)
+        {
+            return false;
+        }
+        cursor += written;
+        bytes -= static_cast<std::size_t>(written);
+    }
+    return true;
+}
+
+/// Writes `header` and `bytes` of values to a temporary file beside `path`, fsyncs it, then renames it
+/// over `path`. Readers see the old file or the new one, never a torn one, and existing mappings of the
+/// old file stay valid because its inode is not truncated.
+[[nodiscard]] inline std::expected<void, ColumnErrc> replace_file(const char *path, const ColumnFileHeader &header,
+                                                                  const void *data, std::size_t bytes) noexcept
+{
+    constexpr char suffix[] = ".XXXXXX";
+    std::array<char, 4096> temp{};
+    const std::size_t length = std::strlen(path);
+    if (length + sizeof(suffix) > temp.size())
+    {
+        return std::unexpected{ColumnErrc::open_failed};
+    }
+    std::memcpy(temp.data(), path, length);
+    std::memcpy(temp.data() + length, suffix, sizeof(suffix));
+
+    const int fd = ::mkostemp(temp.data(), O_CLOEXEC);
+    if (fd < 0)
+    {
+        return std::unexpected{ColumnErrc::open_failed};
+    }
+    // fsync before rename, so a crash cannot leave the new name pointing at unwritten data. close() is
+    // where some filesystems report deferred write errors.
+    const bool written = ::fchmod(fd, 0644) == 0 && write_all(fd, &header, sizeof(header)) &&
+                         write_all(fd, data, bytes) && ::fsync(fd) == 0;
+    if (::close(fd) != 0 || !written || ::rename(temp.data(), path) != 0)
+    {
+        ::unlink(temp.data());
+        return std::unexpected{ColumnErrc::write_failed};
+    }
+    return {};
+}
+
+} // namespace detail
+
+/// Writes (or atomically replaces) a column file holding `values`
+template <ColumnQuantity Q>
+[[nodiscard]] std::expected<void, ColumnErrc> write_column(const char *path, std::span<const Q> values) noexcept
+{
+    return detail::replace_file(path, column_header_for<Q>(values.size()), values.data(), values.size_bytes());
+}
+
+template <ColumnQuantity Q, typename T>
+[[nodiscard]] std::expected<void, ColumnErrc> write_column(const char *path, QuantitySpan<Q, T> values) noexcept
+{
+    const auto raw = values.raw();
+    return detail::replace_file(path, column_header_for<Q>(raw.size()), raw.data(), raw.size_bytes());
+}
+
+/// Read-only mapping of a column file, typed as Q; move-only, unmaps on destruction
+template <ColumnQuantity Q>
+class MappedColumn
+{
+    using T = typename Q::value_type;
+
+public:
+    using quantity_type = Q;
+    using view_type = QuantitySpan<Q, const T>;
+
+    /// Maps `path` and checks its header against Q: layout and version (bad_header), file size
+    /// (truncated), tag / ratio / origin (unit_mismatch) and element type (type_mismatch)
+    [[nodiscard]] static std::expected<MappedColumn, ColumnErrc> open(const char *path) noexcept
+    {
+        const int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+        {
+            return std::unexpected{ColumnErrc::open_failed};
+        }
+        struct ::stat info{};
+        if (::fstat(fd, &info) != 0)
+        {
+            ::close(fd);
+            return std::unexpected{ColumnErrc::open_failed};
+        }
+        const auto bytes = static_cast<std::size_t>(info.st_size);
+        if (bytes < sizeof(ColumnFileHeader))
+        {
+            ::close(fd);
+            return std::unexpected{ColumnErrc::truncated};
+        }
+        void *address = ::mmap(nullptr, bytes, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd); // the mapping keeps the file open
+        if (address == MAP_FAILED)
+        {
+            return std::unexpected{ColumnErrc::map_failed};
+        }
+        MappedColumn column{address, bytes};
+        if (const auto checked = column.check(); !checked)
+        {
+            return std::unexpected{checked.error()};
+        }
+        return column;
+    }
+
+    MappedColumn(const MappedColumn &) = delete;
+    MappedColumn &operator=(const MappedColumn &) = delete;
+
+    MappedColumn(MappedColumn &&other) noexcept
+        : address_(std::exchange(other.address_, nullptr)), bytes_(std::exchange(other.bytes_, 0))
+    {
+    }
+
+    MappedColumn &operator=(MappedColumn &&other) noexcept
+    {
+        if (this != &other)
+        {
+            unmap();
+            address_ = std::exchange(other.address_, nullptr);
+            bytes_ = std::exchange(other.bytes_, 0);
+        }
+        return *this;
+    }
+
+    ~MappedColumn()
+    {
+        unmap();
+    }
+
+    [[nodiscard]] const ColumnFileHeader &header() const noexcept
+    {
+        return *static_cast<const ColumnFileHeader *>(address_);
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return static_cast<std::size_t>(header().count);
+    }
+
+    [[nodiscard]] view_type view() const noexcept
+    {
+        const auto *base = static_cast<const std::byte *>(address_);
+        return view_type{reinterpret_cast<const T *>(base + header().data_offset), size()};
+    }
+
+    [[nodiscard]] Q operator[](std::size_t index) const noexcept
+    {
+        return view()[index];
+    }
+
+private:
+    MappedColumn(void *address, std::size_t bytes) noexcept : address_(address), bytes_(bytes)
+    {
+    }
+
+    [[nodiscard]] std::expected<void, ColumnErrc> check() const noexcept
+    {
+        const ColumnFileHeader &h = header();
+        const ColumnFileHeader expected = column_header_for<Q>(h.count);
+        if (h.magic != COLUMN_FILE_MAGIC || h.version != COLUMN_FILE_VERSION || h.data_offset < sizeof(h) ||
+            h.data_offset % alignof(T) != 0)
+        {
+            return std::unexpected{ColumnErrc::bad_header};
+        }
+        if (h.tag_id != expected.tag_id || h.ratio_num != expected.ratio_num || h.ratio_den != expected.ratio_den ||
+            h.origin_id != expected.origin_id)
+        {
+            return std::unexpected{ColumnErrc::unit_mismatch};
+        }
+        if (h.element_code != expected.element_code)
+        {
+            return std::unexpected{ColumnErrc::type_mismatch};
+        }
+        if (h.data_offset > bytes_ || h.count > (bytes_ - h.data_offset) / sizeof(T))
+        {
+            return std::unexpected{ColumnErrc::truncated};
+        }
+        return {};
+    }
+
+    void unmap() noexcept
+    {
+        if (address_ != nullptr)
+        {
+            ::munmap(address_, bytes_);
+            address_ = nullptr;
+        }
+    }
+
+    void *address_ = nullptr;
+    std::size_t bytes_ = 0;
+};
+
+} // namespace strong_types
+
+#endif // STRONG_TYPES_HAS_MMAP
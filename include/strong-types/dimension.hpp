@@ -0,0 +1,152 @@
+#pragma once
+
+#include "strong.hpp"
+
+#include <type_traits>
+
+namespace strong_types
+{
+
+// ---- Dimension: compile-time exponent vector over the SI base dimensions ----
+//
+// A Dimension is a complete tag type, so it plugs into Strong<T, Tag>, ScaledUnit and
+// QuantityPoint unchanged. Products and quotients add and subtract exponents through one partial
+// specialization each, so any derived quantity (jerk, N·s, W/m²) needs no new trait. Plane angle
+// is carried as an extra pseudo-base exponent so that rad/s stays distinct from Hz and N·m/rad
+// (torque) stays distinct from J. A result with every exponent zero maps back to the `void` tag.
+
+template <int Length, int Mass, int Time, int Current = 0, int Temperature = 0, int Amount = 0, int Luminosity = 0,
+          int Angle = 0>
+struct Dimension
+{
+    static constexpr int length = Length;
+    static constexpr int mass = Mass;
+    static constexpr int time = Time;
+    static constexpr int current = Current;
+    static constexpr int temperature = Temperature;
+    static constexpr int amount = Amount;
+    static constexpr int luminosity = Luminosity;
+    static constexpr int angle = Angle;
+};
+
+using Dimensionless = Dimension<0, 0, 0>;
+
+template <typename>
+inline constexpr bool is_dimension_v = false;
+
+template <int... E>
+inline constexpr bool is_dimension_v<Dimension<E...>> = true;
+
+namespace detail
+{
+
+/// Dimensionless results collapse to the `void` tag used for plain ratios
+template <typename D>
+using dimension_or_void_t = std::conditional_t<std::is_same_v<D, Dimensionless>, void, D>;
+
+template <typename D>
+struct dimension_inverse;
+
+template <int... E>
+struct dimension_inverse<Dimension<E...>>
+{
+    using type = Dimension<(-E)...>;
+};
+
+template <typename L, typename R>
+struct dimension_product;
+
+template <int... A, int... B>
+struct dimension_product<Dimension<A...>, Dimension<B...>>
+{
+    using type = Dimension<(A + B)...>;
+};
+
+template <typename D, int N>
+struct dimension_power;
+
+template <int... E, int N>
+struct dimension_power<Dimension<E...>, N>
+{
+    using type = Dimension<(E * N)...>;
+};
+
+} // namespace detail
+
+template <typename L, typename R>
+using dimension_product_t = detail::dimension_or_void_t<typename detail::dimension_product<L, R>::type>;
+
+template <typename L, typename R>
+using dimension_quotient_t = detail::dimension_or_void_t<
+    typename detail::dimension_product<L, typename detail::dimension_inverse<R>::type>::type>;
+
+template <typename D, int N>
+using dimension_power_t = detail::dimension_or_void_t<typename detail::dimension_power<D, N>::type>;
+
+// ---- tag-level traits for Dimension tags ----
+
+template <int... E>
+struct tag_sum_result<Dimension<E...>, Dimension<E...>>
+{
+    using type = Dimension<E...>;
+};
+
+template <int... E>
+struct tag_difference_result<Dimension<E...>, Dimension<E...>>
+{
+    using type = Dimension<E...>;
+};
+
+// Exponents are combined in place rather than through the dimension_*_t helpers: one class
+// template instantiation per operation keeps lookup as cheap as a hand-written table entry
+template <int... A, int... B>
+struct tag_product_result<Dimension<A...>, Dimension<B...>>
+{
+    using type = detail::dimension_or_void_t<Dimension<(A + B)...>>;
+};
+
+template <int... A, int... B>
+struct tag_quotient_result<Dimension<A...>, Dimension<B...>>
+{
+    using type = detail::dimension_or_void_t<Dimension<(A - B)...>>;
+};
+
+/// 1 / quantity, e.g. 1 / seconds → hertz
+template <int... E>
+struct tag_quotient_result<void, Dimension<E...>>
+{
+    using type = Dimension<(-E)...>;
+};
+
+// ---- named dimensions ----
+
+namespace dim
+{
+using Length = Dimension<1, 0, 0>;
+using Mass = Dimension<0, 1, 0>;
+using Time = Dimension<0, 0, 1>;
+using Current = Dimension<0, 0, 0, 1>;
+using Temperature = Dimension<0, 0, 0, 0, 1>;
+using Amount = Dimension<0, 0, 0, 0, 0, 1>;
+using Luminosity = Dimension<0, 0, 0, 0, 0, 0, 1>;
+using Angle = Dimension<0, 0, 0, 0, 0, 0, 0, 1>;
+
+using Area = dimension_power_t<Length, 2>;
+using Volume = dimension_power_t<Length, 3>;
+using Frequency = dimension_power_t<Time, -1>;
+using Speed = dimension_quotient_t<Length, Time>;
+using Acceleration = dimension_quotient_t<Speed, Time>;
+using Jerk = dimension_quotient_t<Acceleration, Time>;
+using Force = dimension_product_t<Mass, Acceleration>;
+using Impulse = dimension_product_t<Force, Time>;
+using Energy = dimension_product_t<Force, Length>;
+using Power = dimension_quotient_t<Energy, Time>;
+using Pressure = dimension_quotient_t<Force, Area>;
+using Density = dimension_quotient_t<Mass, Volume>;
+using Voltage = dimension_quotient_t<Power, Current>;
+using SolidAngle = dimension_power_t<Angle, 2>;
+using AngularVelocity = dimension_quotient_t<Angle, Time>;
+using Torque = dimension_quotient_t<Energy, Angle>;
+} // namespace dim
+
+} // namespace strong_types
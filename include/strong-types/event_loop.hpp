@@ -0,0 +1,398 @@
+#pragma once
+
+#include "clock.hpp"
+#include "si_chrono.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <expected>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if __has_include(<sys/epoll.h>) && __has_include(<sys/timerfd.h>)
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+#define STRONG_TYPES_HAS_EPOLL 1
+#else
+#define STRONG_TYPES_HAS_EPOLL 0
+#endif
+
+#if STRONG_TYPES_HAS_EPOLL
+
+namespace strong_types
+{
+
+class EventLoop;
+
+// ---- Task: fire-and-forget coroutine, started lazily by EventLoop::spawn ----
+
+class Task
+{
+public:
+    struct promise_type
+    {
+        EventLoop *loop = nullptr;
+
+        promise_type() = default;
+        promise_type(const promise_type &) = delete;
+        promise_type &operator=(const promise_type &) = delete;
+        promise_type(promise_type &&) = delete;
+        promise_type &operator=(promise_type &&) = delete;
+        ~promise_type();
+
+        [[nodiscard]] Task get_return_object() noexcept
+        {
+            return Task{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+
+        [[nodiscard]] std::suspend_always initial_suspend() const noexcept
+        {
+            return {};
+        }
+
+        // The frame frees itself on completion; ~promise_type tells the loop
+        [[nodiscard]] std::suspend_never final_suspend() const noexcept
+        {
+            return {};
+        }
+
+        void return_void() const noexcept
+        {
+        }
+
+        [[noreturn]] void unhandled_exception() const noexcept
+        {
+            std::terminate();
+        }
+    };
+
+    Task(const Task &) = delete;
+    Task &operator=(const Task &) = delete;
+
+    Task(Task &&other) noexcept : handle_(std::exchange(other.handle_, {}))
+    {
+    }
+
+    Task &operator=(Task &&other) noexcept
+    {
+        if (this != &other)
+        {
+            reset();
+            handle_ = std::exchange(other.handle_, {});
+        }
+        return *this;
+    }
+
+    ~Task()
+    {
+        reset();
+    }
+
+private:
+    friend class EventLoop;
+
+    explicit Task(std::coroutine_handle<promise_type> handle) noexcept : handle_(handle)
+    {
+    }
+
+    void reset() noexcept
+    {
+        if (handle_)
+        {
+            std::exchange(handle_, {}).destroy();
+        }
+    }
+
+    std::coroutine_handle<promise_type> handle_;
+};
+
+// ---- EventLoop: single-threaded reference executor on epoll + a CLOCK_MONOTONIC timerfd ----
+//
+// Timers live in a binary min-heap keyed by absolute steady-clock nanoseconds; the timerfd is
+// only re-armed when the earliest deadline changes, so one thread sustains very many timers.
+// Spawned tasks keep a pointer to their loop, so a loop is neither copyable nor movable: create()
+// builds it in place inside the returned std::expected.
+
+class EventLoop
+{
+    struct Key
+    {
+        explicit Key() = default;
+    };
+
+public:
+    [[nodiscard]] static std::expected<EventLoop, std::errc> create() noexcept
+    {
+        const int epoll_fd = ::epoll_create1(EPOLL_CLOEXEC);
+        if (epoll_fd < 0)
+        {
+            return std::unexpected{static_cast<std::errc>(errno)};
+        }
+        const int timer_fd = ::timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+        if (timer_fd < 0)
+        {
+            const auto err = static_cast<std::errc>(errno);
+            ::close(epoll_fd);
+            return std::unexpected{err};
+        }
+        epoll_event ev{};
+        ev.events = EPOLLIN;
+        ev.data.fd = timer_fd;
+        if (::epoll_ctl(epoll_fd, EPOLL_CTL_ADD, timer_fd, &ev) < 0)
+        {
+            const auto err = static_cast<std::errc>(errno);
+            ::close(timer_fd);
+            ::close(epoll_fd);
+            return std::unexpected{err};
+        }
+        return std::expected<EventLoop, std::errc>{std::in_place, Key{}, epoll_fd, timer_fd};
+    }
+
+    /// Used by create(); Key is private, so nothing else can call it
+    EventLoop(Key /*key*/, int epoll_fd, int timer_fd) noexcept : epoll_fd_(epoll_fd), timer_fd_(timer_fd)
+    {
+    }
+
+    EventLoop(const EventLoop &) = delete;
+    EventLoop &operator=(const EventLoop &) = delete;
+    EventLoop(EventLoop &&) = delete;
+    EventLoop &operator=(EventLoop &&) = delete;
+
+    ~EventLoop()
+    {
+        // Suspended tasks never finish: free their frames without running the rest of their bodies
+        for (auto &timer : timers_)
+        {
+            timer.handle.destroy();
+        }
+        for (auto handle : ready_)
+        {
+            handle.destroy();
+        }
+        ::close(timer_fd_);
+        ::close(epoll_fd_);
+    }
+
+    /// The loop currently inside run() on this thread, or nullptr
+    [[nodiscard]] static EventLoop *current() noexcept
+    {
+        return current_ref();
+    }
+
+    /// Take ownership of a task; it starts on the next run() iteration
+    void spawn(Task task)
+    {
+        auto handle = std::exchange(task.handle_, {});
+        handle.promise().loop = this;
+        ++active_;
+        ready_.push_back(handle);
+    }
+
+    /// Run until every spawned task has completed. Fails with the errno of a timerfd or epoll call
+    /// that went wrong; the tasks still pending stay owned by the loop and run() may be called again.
+    [[nodiscard]] std::expected<void, std::errc> run()
+    {
+        auto *const previous = std::exchange(current_ref(), this);
+        std::expected<void, std::errc> result;
+        std::vector<std::coroutine_handle<>> batch;
+        while (active_ > 0 && result)
+        {
+            batch.swap(ready_);
+            for (auto handle : batch)
+            {
+                handle.resume();
+            }
+            batch.clear();
+            if (active_ == 0 || !ready_.empty())
+            {
+                continue;
+            }
+            if (timers_.empty())
+            {
+                break; // remaining tasks wait on something other than this loop
+            }
+            if (!expire_timers(steady_now_ns().get()))
+            {
+                result = wait_for_timer();
+            }
+        }
+        current_ref() = previous;
+        return result;
+    }
+
+    /// Resume `handle` once the steady clock reaches `deadline_ns`
+    void schedule_at(Nanoseconds<std::int64_t> deadline, std::coroutine_handle<> handle)
+    {
+        timers_.push_back(Timer{deadline.get(), next_seq_++, handle});
+        std::push_heap(timers_.begin(), timers_.end(), later);
+    }
+
+    [[nodiscard]] std::size_t pending_timers() const noexcept
+    {
+        return timers_.size();
+    }
+
+    [[nodiscard]] std::size_t active_tasks() const noexcept
+    {
+        return active_;
+    }
+
+private:
+    friend Task::promise_type;
+
+    struct Timer
+    {
+        std::int64_t deadline_ns;
+        std::uint64_t seq; // FIFO among equal deadlines
+        std::coroutine_handle<> handle;
+    };
+
+    static constexpr std::int64_t DISARMED = -1;
+
+    [[nodiscard]] static EventLoop *&current_ref() noexcept
+    {
+        thread_local EventLoop *loop = nullptr;
+        return loop;
+    }
+
+    [[nodiscard]] static bool later(const Timer &a, const Timer &b) noexcept
+    {
+        return a.deadline_ns != b.deadline_ns ? a.deadline_ns > b.deadline_ns : a.seq > b.seq;
+    }
+
+    /// Move every due timer to the ready queue; true if any fired
+    bool expire_timers(std::int64_t now_ns)
+    {
+        bool fired = false;
+        while (!timers_.empty() && timers_.front().deadline_ns <= now_ns)
+        {
+            std::pop_heap(timers_.begin(), timers_.end(), later);
+            ready_.push_back(timers_.back().handle);
+            timers_.pop_back();
+            fired = true;
+        }
+        return fired;
+    }
+
+    [[nodiscard]] std::expected<void, std::errc> wait_for_timer()
+    {
+        const auto deadline = timers_.front().deadline_ns;
+        if (deadline != armed_ns_)
+        {
+            constexpr std::int64_t ns_per_s = 1'000'000'000;
+            itimerspec spec{};
+            spec.it_value.tv_sec = deadline / ns_per_s;
+            spec.it_value.tv_nsec = deadline % ns_per_s;
+            if (::timerfd_settime(timer_fd_, TFD_TIMER_ABSTIME, &spec, nullptr) < 0)
+            {
+                armed_ns_ = DISARMED;
+                return std::unexpected{static_cast<std::errc>(errno)};
+            }
+            armed_ns_ = deadline;
+        }
+
+        epoll_event ev{};
+        const int ready = ::epoll_wait(epoll_fd_, &ev, 1, -1);
+        if (ready < 0)
+        {
+            if (errno == EINTR)
+            {
+                return {}; // a signal handler ran; the caller re-checks the timers
+            }
+            return std::unexpected{static_cast<std::errc>(errno)};
+        }
+        if (ready == 1 && ev.data.fd == timer_fd_)
+        {
+            std::uint64_t expirations = 0;
+            static_cast<void>(::read(timer_fd_, &expirations, sizeof(expirations)));
+            armed_ns_ = DISARMED; // one-shot timer has fired
+        }
+        return {};
+    }
+
+    int epoll_fd_;
+    int timer_fd_;
+    std::int64_t armed_ns_{DISARMED};
+    std::uint64_t next_seq_{0};
+    std::size_t active_{0};
+    std::vector<Timer> timers_;
+    std::vector<std::coroutine_handle<>> ready_;
+};
+
+inline Task::promise_type::~promise_type()
+{
+    if (loop != nullptr)
+    {
+        --loop->active_;
+    }
+}
+
+// ---- awaitables ----
+
+class SleepAwaiter
+{
+public:
+    explicit SleepAwaiter(Nanoseconds<std::int64_t> deadline) noexcept : deadline_ns_(deadline.get())
+    {
+    }
+
+    [[nodiscard]] bool await_ready() const noexcept
+    {
+        return deadline_ns_ <= steady_now_ns().get();
+    }
+
+    /// Schedules the awaiting coroutine on its Task's loop, or on the loop running this thread for
+    /// other coroutine types. With no loop at all the thread blocks until the deadline instead.
+    template <typename Promise>
+    bool await_suspend(std::coroutine_handle<Promise> handle) const
+    {
+        EventLoop *loop = nullptr;
+        if constexpr (std::is_same_v<Promise, Task::promise_type>)
+        {
+            loop = handle.promise().loop;
+        }
+        if (loop == nullptr)
+        {
+            loop = EventLoop::current();
+        }
+        if (loop == nullptr)
+        {
+            sleep_until_ns(Nanoseconds<std::int64_t>{deadline_ns_});
+            return false;
+        }
+        loop->schedule_at(Nanoseconds<std::int64_t>{deadline_ns_}, handle);
+        return true;
+    }
+
+    void await_resume() const noexcept
+    {
+    }
+
+private:
+    std::int64_t deadline_ns_;
+};
+
+/// co_await sleep_for(250.0_ms) — relative to the moment sleep_for is called
+template <TimeUnit U>
+[[nodiscard]] SleepAwaiter sleep_for(U duration) noexcept
+{
+    return SleepAwaiter{Nanoseconds<std::int64_t>{steady_now_ns().get() + to_nanoseconds(duration).get()}};
+}
+
+/// co_await until(deadline) — absolute point on the steady clock
+template <typename T>
+[[nodiscard]] SleepAwaiter until(SteadyTimePoint<T> deadline) noexcept
+{
+    return SleepAwaiter{time_since_origin(deadline)};
+}
+
+} // namespace strong_types
+
+#endif // STRONG_TYPES_HAS_EPOLL
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstdint>
+#include <ratio>
+
+// ---- Explicit instantiation lists for the optional compiled library (strong-types::compiled) ----
+//
+// With STRONG_TYPES_EXTERN_TEMPLATES=1 the common unit_t / ScaledUnit specializations (double, float
+// and int64 over every SI tag and scaled alias) are declared `extern template` by si.hpp and
+// si_scaled.hpp, so including TUs reuse the out-of-line members from the library instead of
+// emitting their own copies. The formatters in fmt.hpp follow STRONG_TYPES_EXTERN_FORMATTERS.
+// The library defines both macros for its consumers through CMake; src/instantiations.cpp
+// expands the same lists with `template`. This header only defines macros, so si.hpp and
+// si_scaled.hpp can include it without a cycle.
+// Library and consumers must agree on STRONG_TYPES_DIMENSION_ENGINE.
+
+#ifndef STRONG_TYPES_EXTERN_TEMPLATES
+#define STRONG_TYPES_EXTERN_TEMPLATES 0
+#endif
+
+#ifndef STRONG_TYPES_EXTERN_FORMATTERS
+#define STRONG_TYPES_EXTERN_FORMATTERS 0
+#endif
+
+// NOLINTBEGIN(cppcoreguidelines-macro-usage) — one list drives both the declarations and the definitions
+#define STRONG_TYPES_FOR_EACH_SI_TAG(X, PREFIX, T)                                                                     \
+    X(PREFIX, T, strong_types::LengthTag)                                                                              \
+    X(PREFIX, T, strong_types::MassTag)                                                                                \
+    X(PREFIX, T, strong_types::TimeTag)                                                                                \
+    X(PREFIX, T, strong_types::AreaTag)                                                                                \
+    X(PREFIX, T, strong_types::SpeedTag)                                                                               \
+    X(PREFIX, T, strong_types::AccelerationTag)                                                                        \
+    X(PREFIX, T, strong_types::ForceTag)                                                                               \
+    X(PREFIX, T, strong_types::EnergyTag)                                                                              \
+    X(PREFIX, T, strong_types::HertzTag)                                                                               \
+    X(PREFIX, T, strong_types::CelsiusTag)                                                                             \
+    X(PREFIX, T, strong_types::VoltTag)                                                                                \
+    X(PREFIX, T, strong_types::RadianTag)                                                                              \
+    X(PREFIX, T, strong_types::SteradianTag)                                                                           \
+    X(PREFIX, T, strong_types::PowerTag)                                                                               \
+    X(PREFIX, T, strong_types::PressureTag)                                                                            \
+    X(PREFIX, T, strong_types::AngularVelocityTag)                                                                     \
+    X(PREFIX, T, strong_types::VolumeTag)                                                                              \
+    X(PREFIX, T, strong_types::DensityTag)                                                                             \
+    X(PREFIX, T, strong_types::TorqueTag)
+
+/// Scaled aliases as (tag, ratio): alias templates cannot follow `struct` in an explicit instantiation
+#define STRONG_TYPES_FOR_EACH_SCALED_ALIAS(X, PREFIX, T)                                                               \
+    X(PREFIX, T, strong_types::LengthTag, std::micro)                      /* Micrometers */                           \
+    X(PREFIX, T, strong_types::LengthTag, std::milli)                      /* Millimeters */                           \
+    X(PREFIX, T, strong_types::LengthTag, std::centi)                      /* Centimeters */                           \
+    X(PREFIX, T, strong_types::LengthTag, std::kilo)                       /* Kilometers */                            \
+    X(PREFIX, T, strong_types::TimeTag, std::nano)                         /* Nanoseconds */                           \
+    X(PREFIX, T, strong_types::TimeTag, std::micro)                        /* Microseconds */                          \
+    X(PREFIX, T, strong_types::TimeTag, std::milli)                        /* Milliseconds */                          \
+    X(PREFIX, T, strong_types::TimeTag, std::ratio<60>)                    /* Minutes */                               \
+    X(PREFIX, T, strong_types::TimeTag, std::ratio<3600>)                  /* Hours */                                 \
+    X(PREFIX, T, strong_types::TimeTag, std::ratio<86400>)                 /* Days */                                  \
+    X(PREFIX, T, strong_types::TimeTag, std::ratio<604800>)                /* Weeks */                                 \
+    X(PREFIX, T, strong_types::MassTag, std::micro)                        /* Milligrams */                            \
+    X(PREFIX, T, strong_types::MassTag, std::milli)                        /* Grams */                                 \
+    X(PREFIX, T, strong_types::MassTag, std::kilo)                         /* Tons */                                  \
+    X(PREFIX, T, strong_types::SpeedTag, std::ratio<5 STRONG_TYPES_COMMA 18>) /* KilometersPerHour */
+
+#define STRONG_TYPES_FOR_EACH_VALUE_TYPE(LIST, X, PREFIX)                                                              \
+    LIST(X, PREFIX, double)                                                                                            \
+    LIST(X, PREFIX, float)                                                                                             \
+    LIST(X, PREFIX, std::int64_t)
+
+#define STRONG_TYPES_COMMA ,
+
+#define STRONG_TYPES_INSTANTIATE_STRONG(PREFIX, T, Tag) PREFIX struct strong_types::Strong<T, Tag>;
+#define STRONG_TYPES_INSTANTIATE_SCALED(PREFIX, T, Tag, Ratio) PREFIX struct strong_types::ScaledUnit<T, Tag, Ratio>;
+
+/// `PREFIX` is `template` (definitions) or `extern template` (declarations)
+#define STRONG_TYPES_INSTANTIATE_SI_UNITS(PREFIX)                                                                      \
+    STRONG_TYPES_FOR_EACH_VALUE_TYPE(STRONG_TYPES_FOR_EACH_SI_TAG, STRONG_TYPES_INSTANTIATE_STRONG, PREFIX)
+#define STRONG_TYPES_INSTANTIATE_SCALED_UNITS(PREFIX)                                                                  \
+    STRONG_TYPES_FOR_EACH_VALUE_TYPE(STRONG_TYPES_FOR_EACH_SCALED_ALIAS, STRONG_TYPES_INSTANTIATE_SCALED, PREFIX)
+
+// Formatters: the class and its format<fmt::format_context> member (expanded by fmt.hpp / the library)
+#define STRONG_TYPES_INSTANTIATE_STRONG_FORMATTER(PREFIX, T, Tag)                                                      \
+    PREFIX struct fmt::formatter<strong_types::Strong<T, Tag>>;                                                        \
+    PREFIX fmt::format_context::iterator fmt::formatter<strong_types::Strong<T, Tag>>::format<fmt::format_context>(    \
+        const strong_types::Strong<T, Tag> &, fmt::format_context &) const;
+#define STRONG_TYPES_INSTANTIATE_SCALED_FORMATTER(PREFIX, T, Tag, Ratio)                                               \
+    PREFIX struct fmt::formatter<strong_types::ScaledUnit<T, Tag, Ratio>>;                                             \
+    PREFIX fmt::format_context::iterator                                                                               \
+    fmt::formatter<strong_types::ScaledUnit<T, Tag, Ratio>>::format<fmt::format_context>(                              \
+        const strong_types::ScaledUnit<T, Tag, Ratio> &, fmt::format_context &) const;
+
+#define STRONG_TYPES_INSTANTIATE_FORMATTERS(PREFIX)                                                                    \
+    STRONG_TYPES_FOR_EACH_VALUE_TYPE(STRONG_TYPES_FOR_EACH_SI_TAG, STRONG_TYPES_INSTANTIATE_STRONG_FORMATTER, PREFIX)  \
+    STRONG_TYPES_FOR_EACH_VALUE_TYPE(STRONG_TYPES_FOR_EACH_SCALED_ALIAS, STRONG_TYPES_INSTANTIATE_SCALED_FORMATTER,    \
+                                     PREFIX)
+// NOLINTEND(cppcoreguidelines-macro-usage)
@@ -0,0 +1,654 @@
+#pragma once
+
+#include "hash.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if !defined(STRONG_TYPES_HAS_SSE2)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define STRONG_TYPES_HAS_SSE2 1
+#else
+#define STRONG_TYPES_HAS_SSE2 0
+#endif
+#endif
+
+#if STRONG_TYPES_HAS_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace strong_types
+{
+
+// ---- FlatHashMap: open addressing with group-probed control bytes (Swiss-table layout) ----
+//
+// Slots live in one array, without a node per element. A parallel array of control bytes holds
+// one byte per slot: EMPTY, DELETED, or the low 7 bits of the key's hash (h2) when the slot is full.
+// The high bits (h1) choose the first group, a probe visits whole groups, and one compare
+// (SSE2: 16 bytes; otherwise SWAR on a 64-bit word: 8 bytes) finds every candidate slot in the
+// group whose h2 matches. Keys are compared only for those candidates. A probe stops at the
+// first group that has an EMPTY byte, and the load factor is capped at 7/8.
+//
+// Keys must be trivially copyable: the Strong / ScaledUnit / QuantityPoint / StrongId keys this
+// map is meant for. Define STRONG_TYPES_HAS_SSE2=0 to force the portable SWAR path.
+//
+//   FlatHashMap<EntityId, Pose> poses;
+//   poses[EntityId{42u}] = pose;
+//   poses.find(std::uint64_t{42});   // only when raw_key_lookup<EntityIdTag> is true
+
+namespace detail
+{
+
+inline constexpr std::int8_t CTRL_EMPTY = -128; // 0b1000'0000
+inline constexpr std::int8_t CTRL_DELETED = -2; // 0b1111'1110
+
+/// fmix64 from MurmurHash3: std::hash of an integer is the identity in common standard libraries,
+/// and the group index and h2 need well-mixed bits
+[[nodiscard]] constexpr std::uint64_t hash_mix(std::uint64_t x) noexcept
+{
+    x ^= x >> 33U;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33U;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33U;
+    return x;
+}
+
+/// Set bits mark matching slots; each slot owns 2^Shift bits of the mask
+template <typename Bits, unsigned Shift>
+class GroupMask
+{
+public:
+    constexpr explicit GroupMask(Bits bits) noexcept : bits_(bits)
+    {
+    }
+
+    [[nodiscard]] constexpr explicit operator bool() const noexcept
+    {
+        return bits_ != 0;
+    }
+
+    [[nodiscard]] constexpr std::size_t lowest() const noexcept
+    {
+        return static_cast<std::size_t>(std::countr_zero(bits_)) >> Shift;
+    }
+
+    constexpr void clear_lowest() noexcept
+    {
+        bits_ = static_cast<Bits>(bits_ & (bits_ - 1U));
+    }
+
+private:
+    Bits bits_;
+};
+
+#if STRONG_TYPES_HAS_SSE2
+
+class Group
+{
+public:
+    static constexpr std::size_t WIDTH = 16;
+    using Mask = GroupMask<std::uint32_t, 0>;
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) — unaligned 16-byte load
+    explicit Group(const std::int8_t *ctrl) noexcept : ctrl_(_mm_loadu_si128(reinterpret_cast<const __m128i *>(ctrl)))
+    {
+    }
+
+    [[nodiscard]] Mask match(std::int8_t h2) const noexcept
+    {
+        return Mask{static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_)))};
+    }
+
+    [[nodiscard]] Mask match_empty() const noexcept
+    {
+        return match(CTRL_EMPTY);
+    }
+
+    /// EMPTY and DELETED are the only control bytes with the sign bit set
+    [[nodiscard]] Mask match_empty_or_deleted() const noexcept
+    {
+        return Mask{static_cast<std::uint32_t>(_mm_movemask_epi8(ctrl_))};
+    }
+
+private:
+    __m128i ctrl_;
+};
+
+#else
+
+class Group
+{
+    static constexpr std::uint64_t LSBS = 0x0101010101010101ULL;
+    static constexpr std::uint64_t MSBS = 0x8080808080808080ULL;
+
+public:
+    static constexpr std::size_t WIDTH = 8;
+    using Mask = GroupMask<std::uint64_t, 3>;
+
+    explicit Group(const std::int8_t *ctrl) noexcept
+    {
+        // Byte i of the group always lands in bits [8i, 8i + 8), whatever the host endianness
+        for (std::size_t i = 0; i < WIDTH; ++i)
+        {
+            ctrl_ |= std::uint64_t{static_cast<std::uint8_t>(ctrl[i])} << (8U * i);
+        }
+    }
+
+    /// May report a false positive next to a true match; callers compare keys anyway
+    [[nodiscard]] Mask match(std::int8_t h2) const noexcept
+    {
+        const std::uint64_t x = ctrl_ ^ (LSBS * static_cast<std::uint8_t>(h2));
+        return Mask{(x - LSBS) & ~x & MSBS};
+    }
+
+    /// EMPTY has bit 1 clear, DELETED has it set
+    [[nodiscard]] Mask match_empty() const noexcept
+    {
+        return Mask{ctrl_ & ~(ctrl_ << 6U) & MSBS};
+    }
+
+    [[nodiscard]] Mask match_empty_or_deleted() const noexcept
+    {
+        return Mask{ctrl_ & MSBS};
+    }
+
+private:
+    std::uint64_t ctrl_ = 0;
+};
+
+#endif // STRONG_TYPES_HAS_SSE2
+
+} // namespace detail
+
+/// A map keyed by K may be searched with L: the key itself, or its bare value_type when the key's
+/// tag opts in through raw_key_lookup
+template <typename L, typename K>
+concept FlatMapLookup = std::same_as<L, K> || (requires {
+                                                  typename K::tag_type;
+                                                  typename K::value_type;
+                                              } && raw_key_lookup_v<typename K::tag_type> &&
+                                               std::same_as<L, typename K::value_type>);
+
+template <typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+    requires std::is_trivially_copyable_v<K>
+class FlatHashMap
+{
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = std::pair<const K, V>;
+    using size_type = std::size_t;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+
+    static constexpr size_type GROUP_WIDTH = detail::Group::WIDTH;
+
+    template <bool Const>
+    class basic_iterator
+    {
+        using map_pointer = std::conditional_t<Const, const FlatHashMap *, FlatHashMap *>;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = FlatHashMap::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const value_type *, value_type *>;
+        using reference = std::conditional_t<Const, const value_type &, value_type &>;
+
+        basic_iterator() noexcept = default;
+
+        basic_iterator(map_pointer map, size_type index) noexcept : map_(map), index_(index)
+        {
+        }
+
+        /// iterator -> const_iterator
+        template <bool OtherConst>
+            requires(Const && !OtherConst)
+        basic_iterator(const basic_iterator<OtherConst> &other) noexcept // NOLINT(google-explicit-constructor)
+            : map_(other.map_), index_(other.index_)
+        {
+        }
+
+        [[nodiscard]] reference operator*() const noexcept
+        {
+            return map_->slots_[index_];
+        }
+
+        [[nodiscard]] pointer operator->() const noexcept
+        {
+            return std::addressof(map_->slots_[index_]);
+        }
+
+        basic_iterator &operator++() noexcept
+        {
+            index_ = map_->next_full(index_ + 1);
+            return *this;
+        }
+
+        basic_iterator operator++(int) noexcept
+        {
+            auto prev = *this;
+            ++*this;
+            return prev;
+        }
+
+        [[nodiscard]] bool operator==(const basic_iterator &rhs) const noexcept
+        {
+            return index_ == rhs.index_;
+        }
+
+    private:
+        friend class FlatHashMap;
+        template <bool>
+        friend class basic_iterator;
+
+        map_pointer map_ = nullptr;
+        size_type index_ = 0;
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    FlatHashMap() = default;
+
+    FlatHashMap(const FlatHashMap &other) : hash_(other.hash_), equal_(other.equal_)
+    {
+        reserve(other.size_);
+        for (const auto &[key, value] : other)
+        {
+            emplace_new(key, hash_of(key), value);
+        }
+    }
+
+    FlatHashMap(FlatHashMap &&other) noexcept
+        : ctrl_(std::move(other.ctrl_)), slots_(std::exchange(other.slots_, nullptr)),
+          capacity_(std::exchange(other.capacity_, 0)), size_(std::exchange(other.size_, 0)),
+          growth_left_(std::exchange(other.growth_left_, 0)), hash_(std::move(other.hash_)),
+          equal_(std::move(other.equal_))
+    {
+        other.ctrl_.clear();
+    }
+
+    FlatHashMap &operator=(const FlatHashMap &other)
+    {
+        if (this != &other)
+        {
+            FlatHashMap copy{other};
+            swap(copy);
+        }
+        return *this;
+    }
+
+    FlatHashMap &operator=(FlatHashMap &&other) noexcept
+    {
+        FlatHashMap moved{std::move(other)};
+        swap(moved);
+        return *this;
+    }
+
+    ~FlatHashMap()
+    {
+        destroy_all();
+        deallocate();
+    }
+
+    void swap(FlatHashMap &other) noexcept
+    {
+        using std::swap;
+        swap(ctrl_, other.ctrl_);
+        swap(slots_, other.slots_);
+        swap(capacity_, other.capacity_);
+        swap(size_, other.size_);
+        swap(growth_left_, other.growth_left_);
+        swap(hash_, other.hash_);
+        swap(equal_, other.equal_);
+    }
+
+    [[nodiscard]] size_type size() const noexcept
+    {
+        return size_;
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return size_ == 0;
+    }
+
+    /// Slots allocated (a power of two, at least GROUP_WIDTH once anything is inserted)
+    [[nodiscard]] size_type capacity() const noexcept
+    {
+        return capacity_;
+    }
+
+    /// Room for `count` elements without rehashing
+    void reserve(size_type count)
+    {
+        if (count > size_ + growth_left_)
+        {
+            rehash(capacity_for(count));
+        }
+    }
+
+    /// Destroys every element; keeps the allocation
+    void clear() noexcept
+    {
+        destroy_all();
+        std::fill(ctrl_.begin(), ctrl_.end(), detail::CTRL_EMPTY);
+        size_ = 0;
+        growth_left_ = max_load(capacity_);
+    }
+
+    // ---- lookup ----
+
+    template <FlatMapLookup<K> L>
+    [[nodiscard]] iterator find(const L &key)
+    {
+        return iterator{this, find_index(as_key(key))};
+    }
+
+    template <FlatMapLookup<K> L>
+    [[nodiscard]] const_iterator find(const L &key) const
+    {
+        return const_iterator{this, find_index(as_key(key))};
+    }
+
+    template <FlatMapLookup<K> L>
+    [[nodiscard]] bool contains(const L &key) const
+    {
+        return find_index(as_key(key)) != capacity_;
+    }
+
+    // ---- modifiers ----
+
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(const K &key, Args &&...args)
+    {
+        const std::uint64_t hash = hash_of(key);
+        if (const size_type found = find_index(key, hash); found != capacity_)
+        {
+            return {iterator{this, found}, false};
+        }
+        return {iterator{this, emplace_new(key, hash, std::forward<Args>(args)...)}, true};
+    }
+
+    std::pair<iterator, bool> insert(const value_type &value)
+    {
+        return try_emplace(value.first, value.second);
+    }
+
+    template <typename M>
+    std::pair<iterator, bool> insert_or_assign(const K &key, M &&value)
+    {
+        const std::uint64_t hash = hash_of(key);
+        if (const size_type found = find_index(key, hash); found != capacity_)
+        {
+            slots_[found].second = std::forward<M>(value);
+            return {iterator{this, found}, false};
+        }
+        return {iterator{this, emplace_new(key, hash, std::forward<M>(value))}, true};
+    }
+
+    V &operator[](const K &key)
+        requires std::default_initializable<V>
+    {
+        return try_emplace(key).first->second;
+    }
+
+    /// Number of elements erased (0 or 1)
+    template <FlatMapLookup<K> L>
+    size_type erase(const L &key)
+    {
+        const size_type index = find_index(as_key(key));
+        if (index == capacity_)
+        {
+            return 0;
+        }
+        erase_at(index);
+        return 1;
+    }
+
+    /// Returns the iterator past `pos`
+    iterator erase(const_iterator pos)
+    {
+        const size_type index = pos.index_;
+        erase_at(index);
+        return iterator{this, next_full(index + 1)};
+    }
+
+    // ---- iteration (slot order) ----
+
+    [[nodiscard]] iterator begin() noexcept
+    {
+        return iterator{this, next_full(0)};
+    }
+
+    [[nodiscard]] iterator end() noexcept
+    {
+        return iterator{this, capacity_};
+    }
+
+    [[nodiscard]] const_iterator begin() const noexcept
+    {
+        return const_iterator{this, next_full(0)};
+    }
+
+    [[nodiscard]] const_iterator end() const noexcept
+    {
+        return const_iterator{this, capacity_};
+    }
+
+private:
+    using slot_allocator = std::allocator<value_type>;
+    using slot_traits = std::allocator_traits<slot_allocator>;
+
+    [[nodiscard]] static constexpr size_type max_load(size_type capacity) noexcept
+    {
+        return capacity - capacity / 8;
+    }
+
+    [[nodiscard]] static constexpr size_type capacity_for(size_type count) noexcept
+    {
+        size_type capacity = GROUP_WIDTH;
+        while (max_load(capacity) < count)
+        {
+            capacity *= 2;
+        }
+        return capacity;
+    }
+
+    template <typename L>
+    [[nodiscard]] static constexpr const K &as_key(const L &key) noexcept
+        requires std::same_as<L, K>
+    {
+        return key;
+    }
+
+    template <typename L>
+    [[nodiscard]] static constexpr K as_key(const L &raw) noexcept
+        requires(!std::same_as<L, K>)
+    {
+        return K{raw};
+    }
+
+    [[nodiscard]] std::uint64_t hash_of(const K &key) const
+    {
+        return detail::hash_mix(static_cast<std::uint64_t>(hash_(key)));
+    }
+
+    [[nodiscard]] static constexpr std::int8_t h2(std::uint64_t hash) noexcept
+    {
+        return static_cast<std::int8_t>(hash & 0x7FU);
+    }
+
+    [[nodiscard]] size_type find_index(const K &key) const
+    {
+        return capacity_ == 0 ? capacity_ : find_index(key, hash_of(key));
+    }
+
+    /// Slot holding `key`, or capacity_ when absent
+    [[nodiscard]] size_type find_index(const K &key, std::uint64_t hash) const
+    {
+        if (capacity_ == 0)
+        {
+            return capacity_;
+        }
+        const size_type group_mask = capacity_ / GROUP_WIDTH - 1;
+        size_type group = (hash >> 7U) & group_mask;
+        for (size_type step = 1;; ++step)
+        {
+            const size_type base = group * GROUP_WIDTH;
+            const detail::Group ctrl{ctrl_.data() + base};
+            for (auto mask = ctrl.match(h2(hash)); mask; mask.clear_lowest())
+            {
+                const size_type index = base + mask.lowest();
+                if (equal_(slots_[index].first, key))
+                {
+                    return index;
+                }
+            }
+            if (ctrl.match_empty() || step > group_mask)
+            {
+                return capacity_;
+            }
+            group = (group + step) & group_mask; // triangular: visits every group once
+        }
+    }
+
+    /// First EMPTY or DELETED slot on the probe sequence of `hash`; the table must not be full
+    [[nodiscard]] size_type find_free(std::uint64_t hash) const noexcept
+    {
+        const size_type group_mask = capacity_ / GROUP_WIDTH - 1;
+        size_type group = (hash >> 7U) & group_mask;
+        for (size_type step = 1;; ++step)
+        {
+            const size_type base = group * GROUP_WIDTH;
+            if (const auto mask = detail::Group{ctrl_.data() + base}.match_empty_or_deleted())
+            {
+                return base + mask.lowest();
+            }
+            group = (group + step) & group_mask;
+        }
+    }
+
+    /// Inserts a key known to be absent; returns its slot
+    template <typename... Args>
+    size_type emplace_new(const K &key, std::uint64_t hash, Args &&...args)
+    {
+        if (growth_left_ == 0)
+        {
+            // Doubling the live count reuses the current capacity when tombstones caused the shortfall
+            rehash(capacity_for(size_ * 2 + 1));
+        }
+        const size_type index = find_free(hash);
+        slot_allocator alloc;
+        slot_traits::construct(alloc, slots_ + index, std::piecewise_construct, std::forward_as_tuple(key),
+                               std::forward_as_tuple(std::forward<Args>(args)...));
+        if (ctrl_[index] == detail::CTRL_EMPTY)
+        {
+            --growth_left_;
+        }
+        ctrl_[index] = h2(hash);
+        ++size_;
+        return index;
+    }
+
+    void erase_at(size_type index) noexcept
+    {
+        slot_allocator alloc;
+        slot_traits::destroy(alloc, slots_ + index);
+        --size_;
+        // No probe ever continued past a group that still has an EMPTY byte, so the slot can go
+        // back to EMPTY instead of becoming a tombstone.
+        const size_type base = index - index % GROUP_WIDTH;
+        if (detail::Group{ctrl_.data() + base}.match_empty())
+        {
+            ctrl_[index] = detail::CTRL_EMPTY;
+            ++growth_left_;
+        }
+        else
+        {
+            ctrl_[index] = detail::CTRL_DELETED;
+        }
+    }
+
+    void rehash(size_type new_capacity)
+    {
+        slot_allocator alloc;
+        std::vector<std::int8_t> new_ctrl(new_capacity, detail::CTRL_EMPTY);
+        value_type *const new_slots = slot_traits::allocate(alloc, new_capacity);
+
+        std::vector<std::int8_t> old_ctrl = std::exchange(ctrl_, std::move(new_ctrl));
+        value_type *const old_slots = std::exchange(slots_, new_slots);
+        const size_type old_capacity = std::exchange(capacity_, new_capacity);
+        growth_left_ = max_load(new_capacity) - size_;
+        for (size_type index = 0; index < old_capacity; ++index)
+        {
+            if (old_ctrl[index] >= 0)
+            {
+                const std::uint64_t hash = hash_of(old_slots[index].first);
+                const size_type target = find_free(hash);
+                slot_traits::construct(alloc, slots_ + target, std::move(old_slots[index]));
+                slot_traits::destroy(alloc, old_slots + index);
+                ctrl_[target] = h2(hash);
+            }
+        }
+        if (old_slots != nullptr)
+        {
+            slot_traits::deallocate(alloc, old_slots, old_capacity);
+        }
+    }
+
+    [[nodiscard]] size_type next_full(size_type index) const noexcept
+    {
+        while (index < capacity_ && ctrl_[index] < 0)
+        {
+            ++index;
+        }
+        return index;
+    }
+
+    void destroy_all() noexcept
+    {
+        if constexpr (!std::is_trivially_destructible_v<value_type>)
+        {
+            slot_allocator alloc;
+            for (size_type index = 0; index < capacity_; ++index)
+            {
+                if (ctrl_[index] >= 0)
+                {
+                    slot_traits::destroy(alloc, slots_ + index);
+                }
+            }
+        }
+    }
+
+    void deallocate() noexcept
+    {
+        if (slots_ != nullptr)
+        {
+            slot_allocator alloc;
+            slot_traits::deallocate(alloc, slots_, capacity_);
+            slots_ = nullptr;
+        }
+    }
+
+    std::vector<std::int8_t> ctrl_;
+    value_type *slots_ = nullptr;
+    size_type capacity_ = 0;
+    size_type size_ = 0;
+    size_type growth_left_ = 0;
+    [[no_unique_address]] Hash hash_{};
+    [[no_unique_address]] KeyEqual equal_{};
+};
+
+} // namespace strong_types
@@ -3,209 +3,9 @@
 #include "quantity_point.hpp"
 #include "si.hpp"
 #include "si_scaled.hpp"
+#include "unit_suffix.hpp"
 
 #include <fmt/format.h>
-#include <string_view>
-
-namespace strong_types
-{
-
-// ---- tag -> suffix mapping ----
-
-template <typename Tag>
-struct tag_suffix
-{
-    static constexpr std::string_view value = "";
-};
-
-template <>
-struct tag_suffix<LengthTag>
-{
-    static constexpr std::string_view value = "m";
-};
-template <>
-struct tag_suffix<MassTag>
-{
-    static constexpr std::string_view value = "kg";
-};
-template <>
-struct tag_suffix<TimeTag>
-{
-    static constexpr std::string_view value = "s";
-};
-template <>
-struct tag_suffix<AreaTag>
-{
-    static constexpr std::string_view value = "m2";
-};
-template <>
-struct tag_suffix<SpeedTag>
-{
-    static constexpr std::string_view value = "m/s";
-};
-template <>
-struct tag_suffix<AccelerationTag>
-{
-    static constexpr std::string_view value = "m/s2";
-};
-template <>
-struct tag_suffix<ForceTag>
-{
-    static constexpr std::string_view value = "N";
-};
-template <>
-struct tag_suffix<EnergyTag>
-{
-    static constexpr std::string_view value = "J";
-};
-template <>
-struct tag_suffix<HertzTag>
-{
-    static constexpr std::string_view value = "Hz";
-};
-template <>
-struct tag_suffix<CelsiusTag>
-{
-    static constexpr std::string_view value = "degC";
-};
-template <>
-struct tag_suffix<VoltTag>
-{
-    static constexpr std::string_view value = "V";
-};
-template <>
-struct tag_suffix<RadianTag>
-{
-    static constexpr std::string_view value = "rad";
-};
-template <>
-struct tag_suffix<SteradianTag>
-{
-    static constexpr std::string_view value = "sr";
-};
-template <>
-struct tag_suffix<PowerTag>
-{
-    static constexpr std::string_view value = "W";
-};
-template <>
-struct tag_suffix<PressureTag>
-{
-    static constexpr std::string_view value = "Pa";
-};
-template <>
-struct tag_suffix<AngularVelocityTag>
-{
-    static constexpr std::string_view value = "rad/s";
-};
-template <>
-struct tag_suffix<VolumeTag>
-{
-    static constexpr std::string_view value = "m3";
-};
-template <>
-struct tag_suffix<DensityTag>
-{
-    static constexpr std::string_view value = "kg/m3";
-};
-template <>
-struct tag_suffix<TorqueTag>
-{
-    static constexpr std::string_view value = "Nm";
-};
-
-// ---- scaled unit -> suffix override ----
-
-template <typename Tag, typename Ratio>
-struct scaled_suffix
-{
-    static constexpr std::string_view value = tag_suffix<Tag>::value;
-};
-
-// Length scales
-template <>
-struct scaled_suffix<LengthTag, std::micro>
-{
-    static constexpr std::string_view value = "um";
-};
-template <>
-struct scaled_suffix<LengthTag, std::milli>
-{
-    static constexpr std::string_view value = "mm";
-};
-template <>
-struct scaled_suffix<LengthTag, std::centi>
-{
-    static constexpr std::string_view value = "cm";
-};
-template <>
-struct scaled_suffix<LengthTag, std::kilo>
-{
-    static constexpr std::string_view value = "km";
-};
-
-// Time scales
-template <>
-struct scaled_suffix<TimeTag, std::nano>
-{
-    static constexpr std::string_view value = "ns";
-};
-template <>
-struct scaled_suffix<TimeTag, std::micro>
-{
-    static constexpr std::string_view value = "us";
-};
-template <>
-struct scaled_suffix<TimeTag, std::milli>
-{
-    static constexpr std::string_view value = "ms";
-};
-template <>
-struct scaled_suffix<TimeTag, std::ratio<60>>
-{
-    static constexpr std::string_view value = "min";
-};
-template <>
-struct scaled_suffix<TimeTag, std::ratio<3600>>
-{
-    static constexpr std::string_view value = "hr";
-};
-template <>
-struct scaled_suffix<TimeTag, std::ratio<86400>>
-{
-    static constexpr std::string_view value = "d";
-};
-template <>
-struct scaled_suffix<TimeTag, std::ratio<604800>>
-{
-    static constexpr std::string_view value = "wk";
-};
-
-// Mass scales (base = kg)
-template <>
-struct scaled_suffix<MassTag, std::ratio<1, 1000000>>
-{
-    static constexpr std::string_view value = "mg";
-};
-template <>
-struct scaled_suffix<MassTag, std::ratio<1, 1000>>
-{
-    static constexpr std::string_view value = "g";
-};
-template <>
-struct scaled_suffix<MassTag, std::kilo>
-{
-    static constexpr std::string_view value = "t";
-};
-
-// Speed scales
-template <>
-struct scaled_suffix<SpeedTag, std::ratio<5, 18>>
-{
-    static constexpr std::string_view value = "km/h";
-};
-
-} // namespace strong_types
 
 // ---- fmt::formatter for Strong<T, Tag> ----
 
@@ -214,6 +14,7 @@ struct fmt::formatter<strong_types::Strong<T, Tag>> : fmt::formatter<T>
 {
     template <typename FormatContext>
     auto format(const strong_types::Strong<T, Tag> &val, FormatContext &ctx) const
+        -> typename FormatContext::iterator
     {
         fmt::formatter<T>::format(val.get(), ctx);
         constexpr auto suffix = strong_types::tag_suffix<Tag>::value;
@@ -232,6 +33,7 @@ struct fmt::formatter<strong_types::ScaledUnit<T, Tag, Ratio>> : fmt::formatter<
 {
     template <typename FormatContext>
     auto format(const strong_types::ScaledUnit<T, Tag, Ratio> &val, FormatContext &ctx) const
+        -> typename FormatContext::iterator
     {
         fmt::formatter<T>::format(val.get(), ctx);
         constexpr auto suffix = strong_types::scaled_suffix<Tag, Ratio>::value;
@@ -250,6 +52,7 @@ struct fmt::formatter<strong_types::QuantityPoint<T, Tag, Origin>> : fmt::format
 {
     template <typename FormatContext>
     auto format(const strong_types::QuantityPoint<T, Tag, Origin> &val, FormatContext &ctx) const
+        -> typename FormatContext::iterator
     {
         fmt::formatter<T>::format(val.get(), ctx);
         constexpr auto suffix = strong_types::tag_suffix<Tag>::value;
@@ -260,3 +63,10 @@ struct fmt::formatter<strong_types::QuantityPoint<T, Tag, Origin>> : fmt::format
         return ctx.out();
     }
 };
+
+// ---- extern formatter instantiations (defined by the compiled companion library) ----
+
+#if STRONG_TYPES_EXTERN_FORMATTERS
+#include "extern_templates.hpp"
+STRONG_TYPES_INSTANTIATE_FORMATTERS(extern template)
+#endif
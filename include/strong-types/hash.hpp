@@ -0,0 +1,90 @@
+#pragma once
+
+#include "quantity_point.hpp"
+#include "si_scaled.hpp"
+#include "slot_map.hpp"
+#include "strong.hpp"
+#include "strong_id.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+namespace strong_types
+{
+
+// ---- std::hash support ----
+//
+// A quantity hashes exactly like its payload: std::hash<Strong<T, Tag>>{}(q) == std::hash<T>{}(q.get()).
+// The tag and ratio are compile-time, so they add nothing to the hash. That equality is what makes
+// raw-value lookup in FlatHashMap sound. Tags opt in to that lookup with raw_key_lookup:
+//
+//   template <> struct strong_types::raw_key_lookup<app::EntityIdTag> : std::true_type {};
+
+/// Whether containers keyed by a quantity with this tag may be searched with the bare value_type
+template <typename Tag>
+struct raw_key_lookup : std::false_type
+{
+};
+
+template <typename Tag>
+inline constexpr bool raw_key_lookup_v = raw_key_lookup<Tag>::value;
+
+template <typename T>
+concept StdHashable = requires(const T &value) {
+    { std::hash<T>{}(value) } -> std::convertible_to<std::size_t>;
+};
+
+} // namespace strong_types
+
+template <typename T, typename Tag>
+    requires strong_types::StdHashable<T>
+struct std::hash<strong_types::Strong<T, Tag>>
+{
+    [[nodiscard]] std::size_t operator()(const strong_types::Strong<T, Tag> &value) const
+        noexcept(noexcept(std::hash<T>{}(value.get())))
+    {
+        return std::hash<T>{}(value.get());
+    }
+};
+
+template <typename T, typename Tag, typename Ratio>
+    requires strong_types::StdHashable<T>
+struct std::hash<strong_types::ScaledUnit<T, Tag, Ratio>>
+{
+    [[nodiscard]] std::size_t operator()(const strong_types::ScaledUnit<T, Tag, Ratio> &value) const
+        noexcept(noexcept(std::hash<T>{}(value.get())))
+    {
+        return std::hash<T>{}(value.get());
+    }
+};
+
+template <typename T, typename Tag, typename Origin>
+    requires strong_types::StdHashable<T>
+struct std::hash<strong_types::QuantityPoint<T, Tag, Origin>>
+{
+    [[nodiscard]] std::size_t operator()(const strong_types::QuantityPoint<T, Tag, Origin> &value) const
+        noexcept(noexcept(std::hash<T>{}(value.get())))
+    {
+        return std::hash<T>{}(value.get());
+    }
+};
+
+template <typename T, typename Tag>
+struct std::hash<strong_types::StrongId<T, Tag>>
+{
+    [[nodiscard]] std::size_t operator()(const strong_types::StrongId<T, Tag> &id) const noexcept
+    {
+        return std::hash<T>{}(id.get());
+    }
+};
+
+template <typename Tag>
+struct std::hash<strong_types::SlotHandle<Tag>>
+{
+    [[nodiscard]] std::size_t operator()(const strong_types::SlotHandle<Tag> &handle) const noexcept
+    {
+        return std::hash<std::uint64_t>{}(handle.bits());
+    }
+};
@@ -0,0 +1,160 @@
+#pragma once
+
+#include "si_chrono.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace strong_types
+{
+
+// ---- LatencyHistogram: HDR-style log-linear histogram of durations ----
+//
+// Each power-of-two range of nanoseconds is split into 2^PrecisionBits linear sub-buckets, so
+// every recorded value is resolved to within a relative error of 2^-PrecisionBits (7 bits ≈ 0.8 %).
+// Values up to 2^RangeBits - 1 ns are tracked (40 bits ≈ 18 min); larger samples saturate into
+// the top bucket while min/max stay exact. Storage is a fixed in-object array: recording is
+// O(1) with no allocation. Not thread-safe — keep one histogram per thread and merge().
+
+template <unsigned PrecisionBits = 7, unsigned RangeBits = 40>
+class LatencyHistogram
+{
+    static_assert(PrecisionBits >= 1 && PrecisionBits < RangeBits, "precision must be finer than the range");
+    static_assert(RangeBits <= 62, "range is limited to int64 nanoseconds");
+
+public:
+    static constexpr std::size_t SUB_BUCKETS = std::size_t{1} << PrecisionBits;
+    static constexpr std::size_t BUCKET_COUNT = (RangeBits - PrecisionBits + 1) * SUB_BUCKETS;
+    static constexpr std::int64_t MAX_TRACKABLE = (std::int64_t{1} << RangeBits) - 1;
+
+    constexpr LatencyHistogram() noexcept = default;
+
+    // ---- recording ----
+
+    template <TimeUnit U>
+    constexpr void record(U sample, std::uint64_t times = 1) noexcept
+    {
+        record_ns(to_nanoseconds(sample).get(), times);
+    }
+
+    constexpr void record_ns(std::int64_t ns, std::uint64_t times = 1) noexcept
+    {
+        counts_[index_of(ns)] += times;
+        total_ += times;
+        sum_ns_ += static_cast<double>(ns) * static_cast<double>(times);
+        min_ns_ = std::min(min_ns_, ns);
+        max_ns_ = std::max(max_ns_, ns);
+    }
+
+    /// Add all samples of `other` (e.g. a per-thread histogram) into this one
+    constexpr void merge(const LatencyHistogram &other) noexcept
+    {
+        for (std::size_t i = 0; i < BUCKET_COUNT; ++i)
+        {
+            counts_[i] += other.counts_[i];
+        }
+        total_ += other.total_;
+        sum_ns_ += other.sum_ns_;
+        min_ns_ = std::min(min_ns_, other.min_ns_);
+        max_ns_ = std::max(max_ns_, other.max_ns_);
+    }
+
+    constexpr void reset() noexcept
+    {
+        *this = LatencyHistogram{};
+    }
+
+    // ---- queries ----
+
+    [[nodiscard]] constexpr std::uint64_t count() const noexcept
+    {
+        return total_;
+    }
+
+    [[nodiscard]] constexpr Nanoseconds<std::int64_t> min() const noexcept
+    {
+        return Nanoseconds<std::int64_t>{total_ == 0 ? std::int64_t{0} : min_ns_};
+    }
+
+    [[nodiscard]] constexpr Nanoseconds<std::int64_t> max() const noexcept
+    {
+        return Nanoseconds<std::int64_t>{total_ == 0 ? std::int64_t{0} : max_ns_};
+    }
+
+    [[nodiscard]] constexpr Nanoseconds<double> mean() const noexcept
+    {
+        return Nanoseconds<double>{total_ == 0 ? 0.0 : sum_ns_ / static_cast<double>(total_)};
+    }
+
+    /// Value at percentile `pct` (0..100): the highest value equivalent to the bucket that holds
+    /// the rank, clamped to the exact min/max — e.g. percentile(99.9) for p99.9
+    [[nodiscard]] constexpr Nanoseconds<std::int64_t> percentile(double pct) const noexcept
+    {
+        if (total_ == 0)
+        {
+            return Nanoseconds<std::int64_t>{std::int64_t{0}};
+        }
+        const double clamped = std::clamp(pct, 0.0, 100.0);
+        auto rank = static_cast<std::uint64_t>(clamped / 100.0 * static_cast<double>(total_) + 0.5);
+        rank = std::clamp(rank, std::uint64_t{1}, total_);
+
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i < BUCKET_COUNT; ++i)
+        {
+            seen += counts_[i];
+            if (seen >= rank)
+            {
+                return Nanoseconds<std::int64_t>{std::clamp(highest_equivalent(i), min_ns_, max_ns_)};
+            }
+        }
+        return max();
+    }
+
+    /// Number of samples in bucket `idx`; lowest_equivalent/highest_equivalent give its value range
+    [[nodiscard]] constexpr std::uint64_t bucket(std::size_t idx) const noexcept
+    {
+        return counts_[idx];
+    }
+
+    [[nodiscard]] static constexpr std::int64_t lowest_equivalent(std::size_t idx) noexcept
+    {
+        if (idx < 2 * SUB_BUCKETS)
+        {
+            return static_cast<std::int64_t>(idx);
+        }
+        const auto shift = idx / SUB_BUCKETS - 1;
+        return static_cast<std::int64_t>((idx - shift * SUB_BUCKETS) << shift);
+    }
+
+    [[nodiscard]] static constexpr std::int64_t highest_equivalent(std::size_t idx) noexcept
+    {
+        const auto shift = idx < 2 * SUB_BUCKETS ? std::size_t{0} : idx / SUB_BUCKETS - 1;
+        return lowest_equivalent(idx) + (std::int64_t{1} << shift) - 1;
+    }
+
+    [[nodiscard]] static constexpr std::size_t index_of(std::int64_t ns) noexcept
+    {
+        const std::uint64_t value = static_cast<std::uint64_t>(std::clamp(ns, std::int64_t{0}, MAX_TRACKABLE));
+        if (value < 2 * SUB_BUCKETS)
+        {
+            return value;
+        }
+        // value has its top bit at position e >= PrecisionBits + 1; keep PrecisionBits + 1 bits of it
+        const auto shift = static_cast<std::size_t>(63 - std::countl_zero(value)) - PrecisionBits;
+        const std::size_t mantissa = value >> shift;
+        return shift * SUB_BUCKETS + mantissa;
+    }
+
+private:
+    std::array<std::uint64_t, BUCKET_COUNT> counts_{};
+    std::uint64_t total_{0};
+    double sum_ns_{0.0};
+    std::int64_t min_ns_{std::numeric_limits<std::int64_t>::max()};
+    std::int64_t max_ns_{std::numeric_limits<std::int64_t>::min()};
+};
+
+} // namespace strong_types
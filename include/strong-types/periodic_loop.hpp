@@ -0,0 +1,272 @@
+#pragma once
+
+#include "clock.hpp"
+#include "si_chrono.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace strong_types
+{
+
+// ---- LatenessHistogram: lock-free log2 histogram of wake-up lateness ----
+//
+// Single writer (the loop thread), any number of concurrent readers. Bucket 0 counts on-time
+// wake-ups (lateness <= 0); bucket i >= 1 counts lateness in [2^(i-1), 2^i) ns.
+
+class LatenessHistogram
+{
+public:
+    static constexpr std::size_t BUCKET_COUNT = 64;
+
+    void record(Nanoseconds<std::int64_t> lateness) noexcept
+    {
+        const auto ns = lateness.get();
+        // bit width via countl_zero: its return type is int on every standard library revision
+        const auto idx =
+            ns <= 0 ? std::size_t{0} : static_cast<std::size_t>(64 - std::countl_zero(static_cast<std::uint64_t>(ns)));
+        // Single writer: plain load/store instead of a locked read-modify-write
+        buckets_[idx].store(buckets_[idx].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        count_.store(count_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        if (ns > max_.load(std::memory_order_relaxed))
+        {
+            max_.store(ns, std::memory_order_relaxed);
+        }
+    }
+
+    [[nodiscard]] std::uint64_t count() const noexcept
+    {
+        return count_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] std::uint64_t bucket(std::size_t idx) const noexcept
+    {
+        return buckets_[idx].load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] Nanoseconds<std::int64_t> max() const noexcept
+    {
+        return Nanoseconds<std::int64_t>{max_.load(std::memory_order_relaxed)};
+    }
+
+    /// Upper bound of the bucket holding percentile `pct` (0..100, like LatencyHistogram)
+    [[nodiscard]] Nanoseconds<std::int64_t> percentile(double pct) const noexcept
+    {
+        const auto total = count();
+        if (total == 0)
+        {
+            return Nanoseconds<std::int64_t>{std::int64_t{0}};
+        }
+        const double clamped = std::clamp(pct, 0.0, 100.0);
+        const auto rank = static_cast<std::uint64_t>(clamped / 100.0 * static_cast<double>(total) + 0.5);
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i < BUCKET_COUNT; ++i)
+        {
+            seen += bucket(i);
+            if (seen >= rank && seen > 0)
+            {
+                return Nanoseconds<std::int64_t>{bucket_upper_bound(i)};
+            }
+        }
+        return max();
+    }
+
+    /// Not safe against a concurrent writer — call while the loop is stopped
+    void reset() noexcept
+    {
+        for (auto &b : buckets_)
+        {
+            b.store(0, std::memory_order_relaxed);
+        }
+        count_.store(0, std::memory_order_relaxed);
+        max_.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    [[nodiscard]] static constexpr std::int64_t bucket_upper_bound(std::size_t idx) noexcept
+    {
+        return idx == 0 ? std::int64_t{0} : static_cast<std::int64_t>((std::uint64_t{1} << (idx - 1)) * 2 - 1);
+    }
+
+    std::array<std::atomic<std::uint64_t>, BUCKET_COUNT> buckets_{};
+    std::atomic<std::uint64_t> count_{0};
+    std::atomic<std::int64_t> max_{0};
+};
+
+// ---- PeriodicLoop: fixed-rate loop on absolute steady-clock deadlines ----
+//
+// Deadlines advance by an integer number of nanoseconds, so the loop never drifts. When an
+// iteration overruns its deadline, the missed ticks are skipped and the loop stays on its
+// original phase grid. The optional spin window sleeps until (deadline - spin) and busy-waits
+// the remainder, trading one core for sub-scheduler-quantum wake-up precision.
+
+class PeriodicLoop
+{
+public:
+    /// A period <= 0 is clamped to 1 ns; create() rejects it instead
+    template <TimeUnit Period, TimeUnit Spin = Nanoseconds<std::int64_t>>
+    explicit PeriodicLoop(Period period, Spin spin = Spin{}) noexcept
+        : period_ns_(std::max(to_nanoseconds(period).get(), std::int64_t{1})), spin_ns_(to_nanoseconds(spin).get())
+    {
+    }
+
+    /// A rate <= 0 Hz is clamped to a 1 ns period; create() rejects it instead
+    template <typename T, TimeUnit Spin = Nanoseconds<std::int64_t>>
+    explicit PeriodicLoop(unit_t<T, HertzTag> rate, Spin spin = Spin{}) noexcept
+        : period_ns_(detail::period_or_min(period_from_rate(rate))), spin_ns_(to_nanoseconds(spin).get())
+    {
+    }
+
+    /// Fails with PeriodErrc::not_positive for a period <= 0
+    template <TimeUnit Period, TimeUnit Spin = Nanoseconds<std::int64_t>>
+    [[nodiscard]] static std::expected<PeriodicLoop, PeriodErrc> create(Period period, Spin spin = Spin{}) noexcept
+    {
+        if (to_nanoseconds(period).get() <= 0)
+        {
+            return std::unexpected(PeriodErrc::not_positive);
+        }
+        return std::expected<PeriodicLoop, PeriodErrc>{std::in_place, period, spin};
+    }
+
+    /// Fails like period_from_rate: not_positive for a rate <= 0 Hz, out_of_range for one too slow
+    template <typename T, TimeUnit Spin = Nanoseconds<std::int64_t>>
+    [[nodiscard]] static std::expected<PeriodicLoop, PeriodErrc> create(unit_t<T, HertzTag> rate,
+                                                                        Spin spin = Spin{}) noexcept
+    {
+        const auto period = period_from_rate(rate);
+        if (!period)
+        {
+            return std::unexpected(period.error());
+        }
+        return std::expected<PeriodicLoop, PeriodErrc>{std::in_place, *period, spin};
+    }
+
+    [[nodiscard]] Nanoseconds<std::int64_t> period() const noexcept
+    {
+        return Nanoseconds<std::int64_t>{period_ns_};
+    }
+
+    /// Arm the first deadline one period after `now`
+    void start(Nanoseconds<std::int64_t> now = steady_now_ns()) noexcept
+    {
+        next_ns_ = now.get() + period_ns_;
+    }
+
+    /// Arm the first deadline at an explicit point on the steady clock
+    template <typename T>
+    void start_at(SteadyTimePoint<T> first_deadline) noexcept
+    {
+        next_ns_ = time_since_origin(first_deadline).get();
+    }
+
+    [[nodiscard]] SteadyTimePoint<double> next_deadline() const noexcept
+    {
+        return to_steady_point(Nanoseconds<std::int64_t>{next_ns_});
+    }
+
+    /// Sleep until the next deadline, record lateness, and advance. Returns the lateness.
+    Nanoseconds<std::int64_t> wait_next() noexcept
+    {
+        auto now = steady_now_ns().get();
+        if (now > next_ns_)
+        {
+            // Overrun: the previous iteration ran past this deadline — skip the missed ticks
+            overruns_.store(overruns_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            next_ns_ += ((now - next_ns_) / period_ns_ + 1) * period_ns_;
+        }
+
+        if (spin_ns_ > 0)
+        {
+            sleep_until_ns(Nanoseconds<std::int64_t>{next_ns_ - spin_ns_});
+            spin_until_ns(Nanoseconds<std::int64_t>{next_ns_});
+        }
+        else
+        {
+            sleep_until_ns(Nanoseconds<std::int64_t>{next_ns_});
+        }
+
+        now = steady_now_ns().get();
+        const Nanoseconds<std::int64_t> lateness{now - next_ns_};
+        lateness_.record(lateness);
+        iterations_.store(iterations_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        next_ns_ += period_ns_;
+        return lateness;
+    }
+
+    /// Run `body` once per period until stop() is called or `body` returns false. Returns without
+    /// running `body` if stop() was already called; clear_stop() re-arms the loop.
+    template <typename Fn>
+        requires std::invocable<Fn &>
+    void run(Fn &&body)
+    {
+        start();
+        while (!stop_.load(std::memory_order_relaxed))
+        {
+            wait_next();
+            if constexpr (std::is_same_v<std::invoke_result_t<Fn &>, bool>)
+            {
+                if (!std::invoke(body))
+                {
+                    break;
+                }
+            }
+            else
+            {
+                std::invoke(body);
+            }
+        }
+    }
+
+    /// Thread-safe: the loop exits after the current iteration, or run() returns at once if it has
+    /// not started yet. The request stays set until clear_stop().
+    void stop() noexcept
+    {
+        stop_.store(true, std::memory_order_relaxed);
+    }
+
+    /// Withdraw a stop() so the next run() loops again; call while the loop is not running
+    void clear_stop() noexcept
+    {
+        stop_.store(false, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] bool stop_requested() const noexcept
+    {
+        return stop_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] std::uint64_t iterations() const noexcept
+    {
+        return iterations_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] std::uint64_t overruns() const noexcept
+    {
+        return overruns_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] const LatenessHistogram &lateness() const noexcept
+    {
+        return lateness_;
+    }
+
+private:
+    std::int64_t period_ns_;
+    std::int64_t spin_ns_;
+    std::int64_t next_ns_{0};
+    std::atomic<bool> stop_{false};
+    std::atomic<std::uint64_t> iterations_{0};
+    std::atomic<std::uint64_t> overruns_{0};
+    LatenessHistogram lateness_;
+};
+
+} // namespace strong_types
@@ -0,0 +1,598 @@
+#pragma once
+
+#include "clock.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <expected>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Profiling is compiled out unless STRONG_TYPES_PROFILING is defined to 1: the scope macro then
+// expands to nothing, ScopedTimer is an empty type, the reports are empty and {fmt} is not needed.
+// Each mode lives in its own inline namespace, so translation units built with different values
+// link without ODR violations.
+#ifndef STRONG_TYPES_PROFILING
+#define STRONG_TYPES_PROFILING 0
+#endif
+
+#if STRONG_TYPES_PROFILING
+#include "fmt.hpp"
+#endif
+
+// Per-thread trace event capacity; events past it are dropped (per-site stats keep counting)
+#ifndef STRONG_TYPES_PROFILING_EVENTS
+#define STRONG_TYPES_PROFILING_EVENTS 65536
+#endif
+
+namespace strong_types::profiling
+{
+
+// ---- CallSite: static description of an instrumented scope ----
+
+struct CallSite
+{
+    std::string_view name;
+    std::string_view file;
+    int line;
+};
+
+// ---- TraceEvent / CallSiteStats ----
+
+struct TraceEvent
+{
+    const CallSite *site;
+    Nanoseconds<std::int64_t> start;
+    Nanoseconds<std::int64_t> duration;
+};
+
+struct CallSiteStats
+{
+    const CallSite *site = nullptr;
+    std::uint64_t count = 0;
+    Nanoseconds<std::int64_t> total{};
+    Nanoseconds<std::int64_t> min{};
+    Nanoseconds<std::int64_t> max{};
+};
+
+enum class TraceErrc
+{
+    open_failed,
+    write_failed
+};
+
+namespace detail
+{
+
+struct FileCloser
+{
+    void operator()(std::FILE *file) const noexcept
+    {
+        static_cast<void>(std::fclose(file));
+    }
+};
+
+[[nodiscard]] inline std::expected<void, TraceErrc> write_file(const char *path, std::string_view text)
+{
+    const std::unique_ptr<std::FILE, FileCloser> file{std::fopen(path, "wb")};
+    if (!file)
+    {
+        return std::unexpected{TraceErrc::open_failed};
+    }
+    if (std::fwrite(text.data(), 1, text.size(), file.get()) != text.size())
+    {
+        return std::unexpected{TraceErrc::write_failed};
+    }
+    return {};
+}
+
+} // namespace detail
+
+#if STRONG_TYPES_PROFILING
+
+inline namespace enabled
+{
+
+// ---- ThreadBuffer: single-writer event log + per-site aggregates, readable from any thread ----
+
+class ThreadBuffer
+{
+public:
+    static constexpr std::size_t EVENT_CAPACITY = STRONG_TYPES_PROFILING_EVENTS;
+    static constexpr std::size_t SITE_CAPACITY = 512;
+
+    /// Events are stored in blocks of this many, allocated as the thread records them
+    static constexpr std::size_t EVENT_BLOCK = std::min<std::size_t>(1024, EVENT_CAPACITY);
+
+    explicit ThreadBuffer(std::uint32_t tid) noexcept : tid_(tid)
+    {
+    }
+
+    /// Hot path: no locks; allocates only on the first event of each block
+    void record(const CallSite &site, std::int64_t start_ns, std::int64_t duration_ns) noexcept
+    {
+        const auto n = size_.load(std::memory_order_relaxed);
+        auto *block = n < EVENT_CAPACITY ? event_block(n / EVENT_BLOCK) : nullptr;
+        if (block != nullptr)
+        {
+            block[n % EVENT_BLOCK] = {&site, start_ns, duration_ns};
+            size_.store(n + 1, std::memory_order_release);
+        }
+        else
+        {
+            dropped_.store(dropped_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+        aggregate(site, duration_ns);
+    }
+
+    [[nodiscard]] std::uint32_t tid() const noexcept
+    {
+        return tid_;
+    }
+
+    [[nodiscard]] std::uint64_t dropped() const noexcept
+    {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+    /// Events published so far (safe while the owning thread keeps recording)
+    template <typename Fn>
+    void for_each_event(Fn &&fn) const
+    {
+        const auto n = size_.load(std::memory_order_acquire);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const auto &ev = blocks_[i / EVENT_BLOCK][i % EVENT_BLOCK];
+            fn(TraceEvent{ev.site, Nanoseconds<std::int64_t>{ev.start_ns}, Nanoseconds<std::int64_t>{ev.duration_ns}});
+        }
+    }
+
+    template <typename Fn>
+    void for_each_site(Fn &&fn) const
+    {
+        for (const auto &slot : sites_)
+        {
+            const auto *site = slot.site.load(std::memory_order_acquire);
+            if (site != nullptr)
+            {
+                fn(CallSiteStats{site,
+                                 slot.count.load(std::memory_order_relaxed),
+                                 Nanoseconds<std::int64_t>{slot.total_ns.load(std::memory_order_relaxed)},
+                                 Nanoseconds<std::int64_t>{slot.min_ns.load(std::memory_order_relaxed)},
+                                 Nanoseconds<std::int64_t>{slot.max_ns.load(std::memory_order_relaxed)}});
+            }
+        }
+    }
+
+    /// Not safe against a concurrent writer; keeps the allocated event blocks
+    void clear() noexcept
+    {
+        size_.store(0, std::memory_order_relaxed);
+        dropped_.store(0, std::memory_order_relaxed);
+        for (auto &slot : sites_)
+        {
+            slot.site.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    struct RawEvent
+    {
+        const CallSite *site;
+        std::int64_t start_ns;
+        std::int64_t duration_ns;
+    };
+
+    // Open-addressed by call-site address; single writer, so plain load/store on each counter
+    struct SiteSlot
+    {
+        std::atomic<const CallSite *> site{nullptr};
+        std::atomic<std::uint64_t> count{0};
+        std::atomic<std::int64_t> total_ns{0};
+        std::atomic<std::int64_t> min_ns{0};
+        std::atomic<std::int64_t> max_ns{0};
+    };
+
+    /// Block `index`, allocated on first use; nullptr when out of memory
+    [[nodiscard]] RawEvent *event_block(std::size_t index) noexcept
+    {
+        auto &block = blocks_[index];
+        if (!block)
+        {
+            block.reset(new (std::nothrow) RawEvent[EVENT_BLOCK]);
+        }
+        return block.get();
+    }
+
+    void aggregate(const CallSite &site, std::int64_t duration_ns) noexcept
+    {
+        auto idx = std::hash<const CallSite *>{}(&site) % SITE_CAPACITY;
+        for (std::size_t probe = 0; probe < SITE_CAPACITY; ++probe, idx = (idx + 1) % SITE_CAPACITY)
+        {
+            auto &slot = sites_[idx];
+            const auto *owner = slot.site.load(std::memory_order_relaxed);
+            if (owner == &site)
+            {
+                constexpr auto relaxed = std::memory_order_relaxed;
+                slot.count.store(slot.count.load(relaxed) + 1, relaxed);
+                slot.total_ns.store(slot.total_ns.load(relaxed) + duration_ns, relaxed);
+                slot.min_ns.store(std::min(slot.min_ns.load(relaxed), duration_ns), relaxed);
+                slot.max_ns.store(std::max(slot.max_ns.load(relaxed), duration_ns), relaxed);
+                return;
+            }
+            if (owner == nullptr)
+            {
+                slot.count.store(1, std::memory_order_relaxed);
+                slot.total_ns.store(duration_ns, std::memory_order_relaxed);
+                slot.min_ns.store(duration_ns, std::memory_order_relaxed);
+                slot.max_ns.store(duration_ns, std::memory_order_relaxed);
+                slot.site.store(&site, std::memory_order_release);
+                return;
+            }
+        }
+    }
+
+    std::uint32_t tid_;
+    // Written only by the owning thread, before the size_ release that publishes the block's events
+    std::array<std::unique_ptr<RawEvent[]>, (EVENT_CAPACITY + EVENT_BLOCK - 1) / EVENT_BLOCK> blocks_{};
+    std::atomic<std::size_t> size_{0};
+    std::atomic<std::uint64_t> dropped_{0};
+    std::array<SiteSlot, SITE_CAPACITY> sites_{};
+};
+
+// ---- Registry: owns every thread's buffer ----
+//
+// Buffers outlive their threads, so a report still covers threads that have exited. A thread
+// that exits hands its buffer back, and the next new thread records into it after the earlier
+// events. Memory is therefore bounded by the peak number of live recording threads, not by the
+// number of threads ever created. Threads that share a buffer share its Chrome trace tid.
+
+class Registry
+{
+public:
+    [[nodiscard]] static Registry &instance()
+    {
+        static Registry registry;
+        return registry;
+    }
+
+    /// Called once per thread, on its first recorded scope
+    [[nodiscard]] std::shared_ptr<ThreadBuffer> acquire()
+    {
+        const std::scoped_lock lock{mutex_};
+        if (!free_.empty())
+        {
+            auto buffer = std::move(free_.back());
+            free_.pop_back();
+            return buffer;
+        }
+        auto buffer = std::make_shared<ThreadBuffer>(static_cast<std::uint32_t>(buffers_.size()));
+        buffers_.push_back(buffer);
+        free_.reserve(buffers_.size()); // release() never allocates
+        return buffer;
+    }
+
+    /// Called when the owning thread exits
+    void release(std::shared_ptr<ThreadBuffer> buffer) noexcept
+    {
+        const std::scoped_lock lock{mutex_};
+        free_.push_back(std::move(buffer));
+    }
+
+    [[nodiscard]] std::vector<std::shared_ptr<const ThreadBuffer>> snapshot() const
+    {
+        const std::scoped_lock lock{mutex_};
+        return {buffers_.begin(), buffers_.end()};
+    }
+
+    /// Buffers ever created: the peak number of threads recording at once
+    [[nodiscard]] std::size_t buffer_count() const
+    {
+        const std::scoped_lock lock{mutex_};
+        return buffers_.size();
+    }
+
+    /// Not safe while other threads are recording
+    void clear()
+    {
+        const std::scoped_lock lock{mutex_};
+        for (const auto &buffer : buffers_)
+        {
+            buffer->clear();
+        }
+    }
+
+private:
+    Registry() = default;
+
+    mutable std::mutex mutex_;
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers_;
+    std::vector<std::shared_ptr<ThreadBuffer>> free_;
+};
+
+} // namespace enabled
+
+namespace detail
+{
+
+/// A thread's claim on a buffer, returned to the registry by its thread_local destructor
+class BufferLease
+{
+public:
+    BufferLease() : buffer_(Registry::instance().acquire())
+    {
+    }
+
+    BufferLease(const BufferLease &) = delete;
+    BufferLease &operator=(const BufferLease &) = delete;
+    BufferLease(BufferLease &&) = delete;
+    BufferLease &operator=(BufferLease &&) = delete;
+
+    ~BufferLease()
+    {
+        Registry::instance().release(std::move(buffer_));
+    }
+
+    [[nodiscard]] ThreadBuffer &buffer() const noexcept
+    {
+        return *buffer_;
+    }
+
+private:
+    std::shared_ptr<ThreadBuffer> buffer_;
+};
+
+} // namespace detail
+
+inline namespace enabled
+{
+
+[[nodiscard]] inline ThreadBuffer &this_thread_buffer()
+{
+    thread_local const detail::BufferLease lease;
+    return lease.buffer();
+}
+
+// ---- ScopedTimer: measures its own lifetime as Nanoseconds<int64_t> ----
+
+class ScopedTimer
+{
+public:
+    explicit ScopedTimer(const CallSite &site) noexcept : site_(&site), start_(steady_now_ns())
+    {
+    }
+
+    ScopedTimer(const ScopedTimer &) = delete;
+    ScopedTimer &operator=(const ScopedTimer &) = delete;
+    ScopedTimer(ScopedTimer &&) = delete;
+    ScopedTimer &operator=(ScopedTimer &&) = delete;
+
+    ~ScopedTimer()
+    {
+        const auto end = steady_now_ns();
+        this_thread_buffer().record(*site_, start_.get(), end.get() - start_.get());
+    }
+
+    [[nodiscard]] Nanoseconds<std::int64_t> elapsed() const noexcept
+    {
+        return Nanoseconds<std::int64_t>{steady_now_ns().get() - start_.get()};
+    }
+
+private:
+    const CallSite *site_;
+    Nanoseconds<std::int64_t> start_;
+};
+
+// ---- aggregation across threads ----
+
+/// Per-call-site totals merged over all threads, sorted by descending total time
+[[nodiscard]] inline std::vector<CallSiteStats> collect_stats()
+{
+    std::vector<CallSiteStats> merged;
+    for (const auto &buffer : Registry::instance().snapshot())
+    {
+        buffer->for_each_site([&](const CallSiteStats &stats) {
+            auto it = std::find_if(
+                merged.begin(), merged.end(), [&](const CallSiteStats &m) { return m.site == stats.site; });
+            if (it == merged.end())
+            {
+                merged.push_back(stats);
+                return;
+            }
+            it->count += stats.count;
+            it->total = it->total + stats.total;
+            it->min = std::min(it->min, stats.min);
+            it->max = std::max(it->max, stats.max);
+        });
+    }
+    std::sort(merged.begin(), merged.end(), [](const CallSiteStats &a, const CallSiteStats &b) {
+        return a.total > b.total;
+    });
+    return merged;
+}
+
+/// One line per call site: "name (file:line)  count  total  mean  min  max"
+[[nodiscard]] inline std::string format_summary()
+{
+    std::string out;
+    for (const auto &s : collect_stats())
+    {
+        const auto mean = Nanoseconds<double>{static_cast<double>(s.total.get()) / static_cast<double>(s.count)};
+        fmt::format_to(std::back_inserter(out),
+                       "{} ({}:{})  count={}  total={:.3f}  mean={:.3f}  min={}  max={}\n",
+                       s.site->name,
+                       s.site->file,
+                       s.site->line,
+                       s.count,
+                       scale_cast<Milliseconds<double>>(Nanoseconds<double>{static_cast<double>(s.total.get())}),
+                       scale_cast<Microseconds<double>>(mean),
+                       s.min,
+                       s.max);
+    }
+    return out;
+}
+
+} // namespace enabled
+
+// ---- Chrome trace export (chrome://tracing, ui.perfetto.dev) ----
+
+namespace detail
+{
+
+inline void append_json_string(std::string &out, std::string_view text)
+{
+    out.push_back('"');
+    for (const char c : text)
+    {
+        switch (c)
+        {
+        case '"':
+            out += "\\\"";
+            break;
+        case '\\':
+            out += "\\\\";
+            break;
+        case '\n':
+            out += "\\n";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20)
+            {
+                fmt::format_to(std::back_inserter(out), "\\u{:04x}", static_cast<unsigned>(c));
+            }
+            else
+            {
+                out.push_back(c);
+            }
+        }
+    }
+    out.push_back('"');
+}
+
+[[nodiscard]] inline double to_trace_us(Nanoseconds<std::int64_t> ns) noexcept
+{
+    return scale_cast<Microseconds<double>>(Nanoseconds<double>{static_cast<double>(ns.get())}).get();
+}
+
+} // namespace detail
+
+inline namespace enabled
+{
+
+/// Complete ("ph":"X") events for every recorded scope, timestamps in microseconds
+[[nodiscard]] inline std::string chrome_trace_json()
+{
+    std::string out = R"({"displayTimeUnit":"ns","traceEvents":[)";
+    bool first = true;
+    for (const auto &buffer : Registry::instance().snapshot())
+    {
+        buffer->for_each_event([&](const TraceEvent &ev) {
+            out += first ? "\n" : ",\n";
+            first = false;
+            out += R"({"name":)";
+            detail::append_json_string(out, ev.site->name);
+            out += R"(,"cat":)";
+            detail::append_json_string(out, ev.site->file);
+            fmt::format_to(std::back_inserter(out),
+                           R"(,"ph":"X","ts":{:.3f},"dur":{:.3f},"pid":1,"tid":{},"args":{{"line":{}}}}})",
+                           detail::to_trace_us(ev.start),
+                           detail::to_trace_us(ev.duration),
+                           buffer->tid(),
+                           ev.site->line);
+        });
+    }
+    out += "\n]}\n";
+    return out;
+}
+
+[[nodiscard]] inline std::expected<void, TraceErrc> write_chrome_trace(const char *path)
+{
+    return detail::write_file(path, chrome_trace_json());
+}
+
+/// Drop all recorded events and stats (not safe while other threads are recording)
+inline void reset()
+{
+    Registry::instance().clear();
+}
+
+} // namespace enabled
+
+#else
+
+inline namespace disabled
+{
+
+/// Empty and constexpr: a scope costs nothing
+class ScopedTimer
+{
+public:
+    explicit constexpr ScopedTimer(const CallSite & /*unused*/) noexcept
+    {
+    }
+
+    [[nodiscard]] constexpr Nanoseconds<std::int64_t> elapsed() const noexcept
+    {
+        return Nanoseconds<std::int64_t>{};
+    }
+};
+
+[[nodiscard]] inline std::vector<CallSiteStats> collect_stats()
+{
+    return {};
+}
+
+[[nodiscard]] inline std::string format_summary()
+{
+    return {};
+}
+
+/// A valid trace with no events
+[[nodiscard]] inline std::string chrome_trace_json()
+{
+    return "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n]}\n";
+}
+
+[[nodiscard]] inline std::expected<void, TraceErrc> write_chrome_trace(const char *path)
+{
+    return detail::write_file(path, chrome_trace_json());
+}
+
+inline void reset() noexcept
+{
+}
+
+} // namespace disabled
+
+#endif // STRONG_TYPES_PROFILING
+
+} // namespace strong_types::profiling
+
+// ---- scope macro ----
+
+// NOLINTBEGIN(cppcoreguidelines-macro-usage) — __FILE__/__LINE__ capture requires a macro
+#define STRONG_TYPES_PROFILE_CONCAT_IMPL(a, b) a##b
+#define STRONG_TYPES_PROFILE_CONCAT(a, b) STRONG_TYPES_PROFILE_CONCAT_IMPL(a, b)
+
+#if STRONG_TYPES_PROFILING
+#define STRONG_TYPES_PROFILE_SCOPE(name)                                                                               \
+    static constexpr ::strong_types::profiling::CallSite STRONG_TYPES_PROFILE_CONCAT(strong_types_site_, __LINE__){   \
+        name, __FILE__, __LINE__};                                                                                     \
+    const ::strong_types::profiling::ScopedTimer STRONG_TYPES_PROFILE_CONCAT(strong_types_timer_, __LINE__)          \
+    {                                                                                                                  \
+        STRONG_TYPES_PROFILE_CONCAT(strong_types_site_, __LINE__)                                                      \
+    }
+#else
+#define STRONG_TYPES_PROFILE_SCOPE(name) static_cast<void>(0)
+#endif
+// NOLINTEND(cppcoreguidelines-macro-usage)
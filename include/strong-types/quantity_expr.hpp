@@ -0,0 +1,220 @@
+#pragma once
+
+#include "si_scaled.hpp"
+
+#include <array>
+#include <cstddef>
+#include <ratio>
+#include <type_traits>
+#include <utility>
+
+namespace strong_types
+{
+
+// ---- QuantityExpr: lazy sum of same-tag scaled operands ----
+//
+// `lazy(5.0_km) + 300.0_m - 20.0_cm` records the operand values and keeps their ratios in the type
+// instead of converting every operand to base units. A subtracted operand is stored with a negated
+// ratio, so the sign is folded into the same compile-time factor as the scale. The expression is
+// evaluated only when it is converted to a target unit:
+//   * floating point: one multiply per term by the pre-folded factor Ratio_i / Target
+//   * integral: terms are summed exactly at common_ratio_t<Ratios...>, where every factor is a whole
+//     number, then scaled into the target with one multiply and one divide — the only rounding step
+//
+// Materialize by copy-initialization (`Centimeters<int> cm = expr;`), `in<Ratio>()`, `as<Target>()` or
+// `to_base()`. Brace-initializing a ScaledUnit from an expression selects its catch-all constructor.
+
+template <typename T, typename Tag, typename... Ratios>
+    requires(sizeof...(Ratios) > 0)
+class QuantityExpr
+{
+public:
+    using value_type = T;
+    using tag_type = Tag;
+    /// Scale at which an integral expression is summed without rounding
+    using common_ratio_type = common_ratio_t<Ratios...>;
+
+    static constexpr std::size_t SIZE = sizeof...(Ratios);
+
+    /// False when evaluating at TargetRatio needs a conversion factor that does not fit T; such
+    /// conversions do not compile. Floating-point expressions are always representable.
+    template <typename TargetRatio>
+    static constexpr bool representable_in =
+        (detail::factor_fits<T, std::ratio_divide<Ratios, common_ratio_type>::num>() && ...) &&
+        detail::factor_fits<T, std::ratio_divide<common_ratio_type, TargetRatio>::num>() &&
+        detail::factor_fits<T, std::ratio_divide<common_ratio_type, TargetRatio>::den>();
+
+    constexpr explicit QuantityExpr(const std::array<T, SIZE> &values) noexcept : values_(values)
+    {
+    }
+
+    /// Operand values in their own scales; subtracted operands carry a negative ratio
+    [[nodiscard]] constexpr const std::array<T, SIZE> &terms() const noexcept
+    {
+        return values_;
+    }
+
+    template <typename TargetRatio>
+    [[nodiscard]] constexpr ScaledUnit<T, Tag, TargetRatio> in() const noexcept
+    {
+        return ScaledUnit<T, Tag, TargetRatio>{evaluate<TargetRatio>(std::index_sequence_for<Ratios...>{})};
+    }
+
+    template <typename Target>
+        requires is_scaled_v<Target> && std::is_same_v<typename Target::value_type, T> &&
+                 std::is_same_v<typename Target::tag_type, Tag>
+    [[nodiscard]] constexpr Target as() const noexcept
+    {
+        return in<typename Target::ratio_type>();
+    }
+
+    /// Result at common_ratio_type — exact for integral T
+    [[nodiscard]] constexpr ScaledUnit<T, Tag, common_ratio_type> eval() const noexcept
+    {
+        return in<common_ratio_type>();
+    }
+
+    [[nodiscard]] constexpr unit_t<T, Tag> to_base() const noexcept
+    {
+        return unit_t<T, Tag>{evaluate<std::ratio<1>>(std::index_sequence_for<Ratios...>{})};
+    }
+
+    template <typename TargetRatio>
+    constexpr operator ScaledUnit<T, Tag, TargetRatio>() const noexcept // NOLINT(google-explicit-constructor)
+    {
+        return in<TargetRatio>();
+    }
+
+    constexpr operator unit_t<T, Tag>() const noexcept // NOLINT(google-explicit-constructor)
+    {
+        return to_base();
+    }
+
+private:
+    template <typename TargetRatio, std::size_t... I>
+    [[nodiscard]] constexpr T evaluate(std::index_sequence<I...> /*unused*/) const noexcept
+    {
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            return (... + (values_[I] * factor<std::ratio_divide<Ratios, TargetRatio>>()));
+        }
+        else
+        {
+            static_assert(representable_in<TargetRatio>, "conversion factor does not fit the value type");
+            using F = std::ratio_divide<common_ratio_type, TargetRatio>;
+            const T sum = (... + static_cast<T>(values_[I] * whole<std::ratio_divide<Ratios, common_ratio_type>>()));
+            return static_cast<T>(sum * static_cast<T>(F::num) / static_cast<T>(F::den));
+        }
+    }
+
+    template <typename F>
+    [[nodiscard]] static constexpr T factor() noexcept
+    {
+        constexpr T value = static_cast<T>(F::num) / static_cast<T>(F::den);
+        return value;
+    }
+
+    template <typename F>
+    [[nodiscard]] static constexpr T whole() noexcept
+    {
+        static_assert(F::den == 1, "every ratio is a whole multiple of the common ratio");
+        return static_cast<T>(F::num);
+    }
+
+    std::array<T, SIZE> values_;
+};
+
+// ---- detector ----
+
+template <typename>
+inline constexpr bool is_quantity_expr_v = false;
+
+template <typename T, typename Tag, typename... Ratios>
+inline constexpr bool is_quantity_expr_v<QuantityExpr<T, Tag, Ratios...>> = true;
+
+// ---- entry points ----
+
+template <typename T, typename Tag, typename R>
+[[nodiscard]] constexpr QuantityExpr<T, Tag, R> lazy(const ScaledUnit<T, Tag, R> &val) noexcept
+{
+    return QuantityExpr<T, Tag, R>{{val.get()}};
+}
+
+template <typename T, typename Tag>
+[[nodiscard]] constexpr QuantityExpr<T, Tag, std::ratio<1>> lazy(const unit_t<T, Tag> &val) noexcept
+{
+    return QuantityExpr<T, Tag, std::ratio<1>>{{val.get()}};
+}
+
+template <typename T, typename Tag, typename... Ratios>
+[[nodiscard]] constexpr QuantityExpr<T, Tag, Ratios...> lazy(const QuantityExpr<T, Tag, Ratios...> &expr) noexcept
+{
+    return expr;
+}
+
+namespace detail
+{
+
+template <typename T, typename Tag, typename... A, typename... B>
+[[nodiscard]] constexpr QuantityExpr<T, Tag, A..., B...> join(const QuantityExpr<T, Tag, A...> &lhs,
+                                                              const QuantityExpr<T, Tag, B...> &rhs) noexcept
+{
+    std::array<T, sizeof...(A) + sizeof...(B)> values{};
+    for (std::size_t i = 0; i < sizeof...(A); ++i)
+    {
+        values[i] = lhs.terms()[i];
+    }
+    for (std::size_t i = 0; i < sizeof...(B); ++i)
+    {
+        values[sizeof...(A) + i] = rhs.terms()[i];
+    }
+    return QuantityExpr<T, Tag, A..., B...>{values};
+}
+
+template <typename LHS, typename RHS>
+concept LazyPair = (is_quantity_expr_v<LHS> || is_quantity_expr_v<RHS>) && requires(const LHS &lhs, const RHS &rhs) {
+    detail::join(lazy(lhs), lazy(rhs));
+};
+
+} // namespace detail
+
+// ---- unary negate: flips every ratio, values are untouched ----
+
+template <typename T, typename Tag, typename... Ratios>
+[[nodiscard]] constexpr QuantityExpr<T, Tag, std::ratio_multiply<Ratios, std::ratio<-1>>...> operator-(
+    const QuantityExpr<T, Tag, Ratios...> &expr) noexcept
+{
+    return QuantityExpr<T, Tag, std::ratio_multiply<Ratios, std::ratio<-1>>...>{expr.terms()};
+}
+
+// ---- add/sub: at least one side is an expression, the other a same-tag ScaledUnit, unit_t or expression ----
+
+template <typename LHS, typename RHS>
+    requires detail::LazyPair<LHS, RHS>
+[[nodiscard]] constexpr auto operator+(const LHS &lhs, const RHS &rhs) noexcept
+{
+    return detail::join(lazy(lhs), lazy(rhs));
+}
+
+template <typename LHS, typename RHS>
+    requires detail::LazyPair<LHS, RHS>
+[[nodiscard]] constexpr auto operator-(const LHS &lhs, const RHS &rhs) noexcept
+{
+    return detail::join(lazy(lhs), -lazy(rhs));
+}
+
+// unit_t on the left also matches Strong's generic operators; these are more specialized than both
+
+template <typename T, typename Tag, typename... Ratios>
+[[nodiscard]] constexpr auto operator+(const unit_t<T, Tag> &lhs, const QuantityExpr<T, Tag, Ratios...> &rhs) noexcept
+{
+    return detail::join(lazy(lhs), rhs);
+}
+
+template <typename T, typename Tag, typename... Ratios>
+[[nodiscard]] constexpr auto operator-(const unit_t<T, Tag> &lhs, const QuantityExpr<T, Tag, Ratios...> &rhs) noexcept
+{
+    return detail::join(lazy(lhs), -rhs);
+}
+
+} // namespace strong_types
@@ -28,7 +28,7 @@ struct QuantityPoint
     }
 
     template <typename U>
-        requires(!std::same_as<std::remove_cvref_t<U>, T>)
+        requires(!std::same_as<std::remove_cvref_t<U>, T> && !std::same_as<std::remove_cvref_t<U>, QuantityPoint>)
     explicit QuantityPoint(U && /*unused*/) // NOLINT(cppcoreguidelines-missing-std-forward,google-explicit-constructor)
     {
         static_assert(always_false_v<U>,
@@ -0,0 +1,397 @@
+#pragma once
+
+#include "strong.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <barrier>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <ranges>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace strong_types
+{
+
+// ---- LSD radix sort for quantity arrays ----
+//
+// std::sort through a defaulted operator<=> costs O(n log n) compares. These sorts make one pass per
+// byte of the value instead, over keys that read the bits of Strong / ScaledUnit / QuantityPoint
+// arrays in place (ValueLayout). Every byte's histogram comes from one read of the input, and a
+// pass whose byte is the same for every element is skipped, so int64 timestamps that share their
+// high bytes cost far fewer than 8 passes.
+//
+// Keys map to unsigned integers that order the same way:
+//   * unsigned: as is
+//   * signed:   sign bit flipped
+//   * floating: negative values have every bit flipped, others only the sign bit. So -inf < ... <
+//               -0.0 < +0.0 < ... < +inf, and NaNs sort to the end matching their sign.
+//
+// The sorts are stable and need a scratch buffer the size of the input (one per payload column too).
+//
+//   radix_sort(timestamps);                                 // std::vector<Nanoseconds<int64_t>>
+//   radix_sort_by_key(ranges, beam_ids);                    // payload follows its key
+//   parallel_radix_sort(timestamps);                        // all hardware threads
+
+enum class SortErrc
+{
+    size_mismatch
+};
+
+template <typename Q>
+concept RadixSortable = requires { typename Q::value_type; } && ValueLayout<Q> &&
+                        std::is_arithmetic_v<typename Q::value_type> &&
+                        !std::same_as<typename Q::value_type, bool> &&
+                        (sizeof(Q) == 1 || sizeof(Q) == 2 || sizeof(Q) == 4 || sizeof(Q) == 8);
+
+/// Below this many elements per thread, parallel_radix_sort runs the single-threaded sort
+inline constexpr std::size_t PARALLEL_RADIX_MIN_PER_THREAD = std::size_t{1} << 18U;
+
+namespace detail
+{
+
+template <std::size_t Bytes>
+struct radix_uint;
+
+template <>
+struct radix_uint<1>
+{
+    using type = std::uint8_t;
+};
+
+template <>
+struct radix_uint<2>
+{
+    using type = std::uint16_t;
+};
+
+template <>
+struct radix_uint<4>
+{
+    using type = std::uint32_t;
+};
+
+template <>
+struct radix_uint<8>
+{
+    using type = std::uint64_t;
+};
+
+/// Order-preserving unsigned image of a quantity's value
+template <RadixSortable Q>
+[[nodiscard]] constexpr auto radix_key(const Q &value) noexcept
+{
+    using T = typename Q::value_type;
+    using U = typename radix_uint<sizeof(Q)>::type;
+    constexpr U SIGN = U{1} << (8U * sizeof(U) - 1U);
+    const auto bits = std::bit_cast<U>(value);
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        return static_cast<U>((bits & SIGN) != 0 ? ~bits : bits | SIGN);
+    }
+    else if constexpr (std::is_signed_v<T>)
+    {
+        return static_cast<U>(bits ^ SIGN);
+    }
+    else
+    {
+        return bits;
+    }
+}
+
+template <RadixSortable Q>
+[[nodiscard]] constexpr std::size_t radix_digit(const Q &value, std::size_t pass) noexcept
+{
+    return static_cast<std::size_t>((radix_key(value) >> (8U * pass)) & 0xFFU);
+}
+
+/// Stand-in payload for key-only sorts
+struct NoPayload
+{
+};
+
+using RadixHistogram = std::array<std::size_t, 256>;
+
+template <typename V>
+struct RadixColumns
+{
+    V *src;
+    V *dst;
+};
+
+template <RadixSortable Q, typename V>
+void radix_sort_serial(std::span<Q> keys, std::span<Q> key_scratch, std::span<V> values, std::span<V> value_scratch)
+{
+    constexpr std::size_t PASSES = sizeof(Q);
+    constexpr bool HAS_PAYLOAD = !std::is_same_v<V, NoPayload>;
+    const std::size_t count = keys.size();
+
+    std::array<RadixHistogram, PASSES> histograms{};
+    for (const Q &key : keys)
+    {
+        for (std::size_t pass = 0; pass < PASSES; ++pass)
+        {
+            ++histograms[pass][radix_digit(key, pass)];
+        }
+    }
+
+    RadixColumns<Q> k{keys.data(), key_scratch.data()};
+    RadixColumns<V> v{values.data(), value_scratch.data()};
+    for (std::size_t pass = 0; pass < PASSES; ++pass)
+    {
+        RadixHistogram &offsets = histograms[pass];
+        if (offsets[radix_digit(k.src[0], pass)] == count)
+        {
+            continue; // every element has the same byte here
+        }
+        std::size_t running = 0;
+        for (auto &bucket : offsets)
+        {
+            running += std::exchange(bucket, running);
+        }
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const std::size_t target = offsets[radix_digit(k.src[i], pass)]++;
+            k.dst[target] = k.src[i];
+            if constexpr (HAS_PAYLOAD)
+            {
+                v.dst[target] = std::move(v.src[i]);
+            }
+        }
+        std::swap(k.src, k.dst);
+        std::swap(v.src, v.dst);
+    }
+
+    if (k.src != keys.data())
+    {
+        std::copy_n(k.src, count, keys.data());
+        if constexpr (HAS_PAYLOAD)
+        {
+            std::move(v.src, v.src + count, values.data());
+        }
+    }
+}
+
+/// One histogram / offsets / scatter round per byte, each thread on its own contiguous chunk. The
+/// threads meet at a barrier after the histograms and after the scatter; offsets for a thread's
+/// chunk are every smaller bucket plus the same bucket in earlier chunks, which keeps the sort stable.
+template <RadixSortable Q, typename V>
+void radix_sort_parallel(std::span<Q> keys, std::span<Q> key_scratch, std::span<V> values,
+                         std::span<V> value_scratch, std::size_t threads)
+{
+    constexpr std::size_t PASSES = sizeof(Q);
+    constexpr bool HAS_PAYLOAD = !std::is_same_v<V, NoPayload>;
+    const std::size_t count = keys.size();
+
+    std::vector<RadixHistogram> histograms(threads);
+    std::barrier sync{static_cast<std::ptrdiff_t>(threads)};
+    std::atomic<bool> abort{false};
+
+    const auto worker = [&](std::size_t self) {
+        const std::size_t begin = count * self / threads;
+        const std::size_t end = count * (self + 1) / threads;
+        RadixColumns<Q> k{keys.data(), key_scratch.data()};
+        RadixColumns<V> v{values.data(), value_scratch.data()};
+        for (std::size_t pass = 0; pass < PASSES; ++pass)
+        {
+            RadixHistogram &local = histograms[self];
+            local.fill(0);
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                ++local[radix_digit(k.src[i], pass)];
+            }
+            sync.arrive_and_wait();
+            if (abort.load(std::memory_order_relaxed))
+            {
+                return; // nothing has been written yet
+            }
+
+            const std::size_t first = radix_digit(k.src[0], pass);
+            std::size_t same = 0;
+            for (const auto &histogram : histograms)
+            {
+                same += histogram[first];
+            }
+            if (same != count)
+            {
+                RadixHistogram offsets{};
+                std::size_t running = 0;
+                for (std::size_t bucket = 0; bucket < offsets.size(); ++bucket)
+                {
+                    for (std::size_t t = 0; t < threads; ++t)
+                    {
+                        if (t == self)
+                        {
+                            offsets[bucket] = running;
+                        }
+                        running += histograms[t][bucket];
+                    }
+                }
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    const std::size_t target = offsets[radix_digit(k.src[i], pass)]++;
+                    k.dst[target] = k.src[i];
+                    if constexpr (HAS_PAYLOAD)
+                    {
+                        v.dst[target] = std::move(v.src[i]);
+                    }
+                }
+                std::swap(k.src, k.dst);
+                std::swap(v.src, v.dst);
+            }
+            sync.arrive_and_wait();
+            if (abort.load(std::memory_order_relaxed))
+            {
+                return; // the calling thread's payload move threw
+            }
+        }
+
+        if (k.src != keys.data())
+        {
+            std::copy(k.src + begin, k.src + end, keys.data() + begin);
+            if constexpr (HAS_PAYLOAD)
+            {
+                std::move(v.src + begin, v.src + end, values.data() + begin);
+            }
+        }
+    };
+
+    // std::thread with explicit joins: std::jthread is still experimental in libc++ 17
+    std::vector<std::thread> pool;
+    pool.reserve(threads - 1);
+    const auto join_all = [&pool] {
+        for (auto &thread : pool)
+        {
+            thread.join();
+        }
+    };
+    try
+    {
+        for (std::size_t t = 1; t < threads; ++t)
+        {
+            pool.emplace_back(worker, t);
+        }
+    }
+    catch (...)
+    {
+        // Release the started workers before they write anything, then report the failure
+        abort.store(true, std::memory_order_relaxed);
+        for (std::size_t missing = pool.size() + 1; missing < threads + 1; ++missing)
+        {
+            sync.arrive_and_drop();
+        }
+        join_all();
+        throw;
+    }
+    try
+    {
+        worker(0);
+    }
+    catch (...)
+    {
+        // A throwing payload move on this thread: leave the barrier so the workers stop at the next one
+        abort.store(true, std::memory_order_relaxed);
+        sync.arrive_and_drop();
+        join_all();
+        throw;
+    }
+    join_all();
+}
+
+template <RadixSortable Q, typename V>
+void radix_sort_dispatch(std::span<Q> keys, std::span<V> values, std::size_t threads)
+{
+    if (keys.size() < 2)
+    {
+        return;
+    }
+    std::vector<Q> key_scratch(keys.size());
+    std::vector<V> value_scratch(values.size());
+    if (threads > 1)
+    {
+        radix_sort_parallel(keys, std::span<Q>{key_scratch}, values, std::span<V>{value_scratch}, threads);
+    }
+    else
+    {
+        radix_sort_serial(keys, std::span<Q>{key_scratch}, values, std::span<V>{value_scratch});
+    }
+}
+
+[[nodiscard]] inline std::size_t radix_threads(std::size_t count, std::size_t requested) noexcept
+{
+    const std::size_t wanted = requested != 0 ? requested : std::max(1U, std::thread::hardware_concurrency());
+    return std::clamp<std::size_t>(count / PARALLEL_RADIX_MIN_PER_THREAD, 1, wanted);
+}
+
+} // namespace detail
+
+template <typename R>
+concept RadixSortableRange = std::ranges::contiguous_range<R> && std::ranges::sized_range<R> &&
+                             RadixSortable<std::ranges::range_value_t<R>> &&
+                             !std::is_const_v<std::remove_reference_t<std::ranges::range_reference_t<R>>>;
+
+/// Stable ascending sort of a contiguous range of quantities
+template <RadixSortableRange R>
+void radix_sort(R &&range)
+{
+    using Q = std::ranges::range_value_t<R>;
+    detail::radix_sort_dispatch(std::span<Q>{std::ranges::data(range), std::ranges::size(range)},
+                                std::span<detail::NoPayload>{}, 1);
+}
+
+/// Sorts `keys` and applies the same permutation to `values`
+template <RadixSortableRange K, std::ranges::contiguous_range P>
+    requires std::movable<std::ranges::range_value_t<P>> && std::default_initializable<std::ranges::range_value_t<P>>
+std::expected<void, SortErrc> radix_sort_by_key(K &&keys, P &&values)
+{
+    using Q = std::ranges::range_value_t<K>;
+    using V = std::ranges::range_value_t<P>;
+    if (std::ranges::size(keys) != std::ranges::size(values))
+    {
+        return std::unexpected(SortErrc::size_mismatch);
+    }
+    detail::radix_sort_dispatch(std::span<Q>{std::ranges::data(keys), std::ranges::size(keys)},
+                                std::span<V>{std::ranges::data(values), std::ranges::size(values)}, 1);
+    return {};
+}
+
+/// radix_sort on up to `threads` threads (0: hardware_concurrency). Inputs with fewer than
+/// PARALLEL_RADIX_MIN_PER_THREAD elements per thread use fewer threads, down to the serial sort.
+/// If a thread cannot be started, the std::system_error propagates and the range is unchanged.
+template <RadixSortableRange R>
+void parallel_radix_sort(R &&range, std::size_t threads = 0)
+{
+    using Q = std::ranges::range_value_t<R>;
+    const std::size_t count = std::ranges::size(range);
+    detail::radix_sort_dispatch(std::span<Q>{std::ranges::data(range), count}, std::span<detail::NoPayload>{},
+                                detail::radix_threads(count, threads));
+}
+
+/// A payload move that throws on the calling thread stops every worker at the next barrier; they are
+/// joined and the exception propagates, with keys and payload in an unspecified order. A throw on a
+/// worker thread calls std::terminate, as with any exception escaping a std::thread.
+template <RadixSortableRange K, std::ranges::contiguous_range P>
+    requires std::movable<std::ranges::range_value_t<P>> && std::default_initializable<std::ranges::range_value_t<P>>
+std::expected<void, SortErrc> parallel_radix_sort_by_key(K &&keys, P &&values, std::size_t threads = 0)
+{
+    using Q = std::ranges::range_value_t<K>;
+    using V = std::ranges::range_value_t<P>;
+    const std::size_t count = std::ranges::size(keys);
+    if (count != std::ranges::size(values))
+    {
+        return std::unexpected(SortErrc::size_mismatch);
+    }
+    detail::radix_sort_dispatch(std::span<Q>{std::ranges::data(keys), count},
+                                std::span<V>{std::ranges::data(values), count}, detail::radix_threads(count, threads));
+    return {};
+}
+
+} // namespace strong_types
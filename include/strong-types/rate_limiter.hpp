@@ -0,0 +1,374 @@
+#pragma once
+
+#include "clock.hpp"
+#include "safe_math.hpp"
+#include "si.hpp"
+#include "si_chrono.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <expected>
+#include <limits>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace strong_types
+{
+
+// ---- Rate limiters: GCRA on integer nanoseconds ----
+//
+// Both limiters track a single theoretical arrival time (TAT) in steady-clock nanoseconds — the
+// generic cell rate algorithm, which is an exact token bucket without a refill step. Every call
+// takes the caller's `now`, so one clock read can be shared across many limiters; the no-argument
+// overloads read the steady clock themselves. Producers::multi keeps the TAT in one atomic that is
+// advanced with a single compare-exchange, so concurrent producers never lock.
+
+enum class Producers
+{
+    single,
+    multi
+};
+
+namespace detail
+{
+
+/// Theoretical arrival time, plain for one producer or atomic for many
+template <Producers P>
+class GcraState
+{
+    static constexpr std::int64_t EMPTY = std::numeric_limits<std::int64_t>::min();
+
+public:
+    /// Apply `step(tat) -> std::optional<std::int64_t>`; a nullopt result rejects and leaves the state untouched
+    template <typename Step>
+    bool update(Step step) noexcept
+    {
+        if constexpr (P == Producers::single)
+        {
+            const auto next = step(tat_);
+            if (!next)
+            {
+                return false;
+            }
+            tat_ = *next;
+            return true;
+        }
+        else
+        {
+            auto tat = tat_.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                const auto next = step(tat);
+                if (!next)
+                {
+                    return false;
+                }
+                if (tat_.compare_exchange_weak(tat, *next, std::memory_order_relaxed, std::memory_order_relaxed))
+                {
+                    return true;
+                }
+            }
+        }
+    }
+
+    [[nodiscard]] std::int64_t load() const noexcept
+    {
+        if constexpr (P == Producers::single)
+        {
+            return tat_;
+        }
+        else
+        {
+            return tat_.load(std::memory_order_relaxed);
+        }
+    }
+
+    void reset() noexcept
+    {
+        if constexpr (P == Producers::single)
+        {
+            tat_ = EMPTY;
+        }
+        else
+        {
+            tat_.store(EMPTY, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    // The shared atomic gets its own cache line so neighbouring limiters do not false-share
+    alignas(P == Producers::multi ? 64 : alignof(std::int64_t))
+        std::conditional_t<P == Producers::single, std::int64_t, std::atomic<std::int64_t>> tat_{EMPTY};
+};
+
+/// Longest interval whose `burst` multiple, the bucket's allowance, still fits in int64 nanoseconds
+[[nodiscard]] constexpr std::int64_t max_interval_ns(std::uint32_t burst) noexcept
+{
+    return std::numeric_limits<std::int64_t>::max() / std::max(std::int64_t{burst}, std::int64_t{1});
+}
+
+/// Non-negative times and costs saturate at int64 max instead of overflowing
+[[nodiscard]] constexpr std::int64_t saturating_add(std::int64_t a, std::int64_t b) noexcept
+{
+    return safe_add(a, b).value_or(std::numeric_limits<std::int64_t>::max());
+}
+
+[[nodiscard]] constexpr std::int64_t saturating_multiply(std::int64_t a, std::int64_t b) noexcept
+{
+    return safe_multiply(a, b).value_or(std::numeric_limits<std::int64_t>::max());
+}
+
+} // namespace detail
+
+// ---- TokenBucket: admit or reject, `burst` requests may arrive back to back ----
+
+template <Producers P = Producers::single>
+class BasicTokenBucket
+{
+public:
+    /// A rate <= 0 Hz is clamped to a 1 ns interval, and an interval whose `burst` multiple overflows
+    /// int64 nanoseconds to detail::max_interval_ns(burst); create() rejects both instead
+    template <typename T>
+    explicit BasicTokenBucket(unit_t<T, HertzTag> rate, std::uint32_t burst = 1) noexcept
+        : interval_ns_(std::min(detail::period_or_min(period_from_rate(rate)), detail::max_interval_ns(burst))),
+          burst_(std::max(burst, std::uint32_t{1}))
+    {
+    }
+
+    /// One token per `interval`; clamped to [1 ns, detail::max_interval_ns(burst)]
+    template <TimeUnit U>
+    explicit BasicTokenBucket(U interval, std::uint32_t burst = 1) noexcept
+        : interval_ns_(
+              std::clamp(to_nanoseconds(interval).get(), std::int64_t{1}, detail::max_interval_ns(burst))),
+          burst_(std::max(burst, std::uint32_t{1}))
+    {
+    }
+
+    /// Fails like period_from_rate: not_positive for a rate <= 0 Hz, out_of_range for one too slow,
+    /// including one whose `burst` intervals do not fit in int64 nanoseconds
+    template <typename T>
+    [[nodiscard]] static std::expected<BasicTokenBucket, PeriodErrc> create(unit_t<T, HertzTag> rate,
+                                                                            std::uint32_t burst = 1) noexcept
+    {
+        const auto interval = period_from_rate(rate);
+        if (!interval)
+        {
+            return std::unexpected(interval.error());
+        }
+        if (interval->get() > detail::max_interval_ns(burst))
+        {
+            return std::unexpected(PeriodErrc::out_of_range);
+        }
+        return std::expected<BasicTokenBucket, PeriodErrc>{std::in_place, *interval, burst};
+    }
+
+    /// Fails with PeriodErrc::not_positive for an interval <= 0, out_of_range when `burst` intervals
+    /// do not fit in int64 nanoseconds
+    template <TimeUnit U>
+    [[nodiscard]] static std::expected<BasicTokenBucket, PeriodErrc> create(U interval, std::uint32_t burst = 1) noexcept
+    {
+        const auto ns = to_nanoseconds(interval).get();
+        if (ns <= 0)
+        {
+            return std::unexpected(PeriodErrc::not_positive);
+        }
+        if (ns > detail::max_interval_ns(burst))
+        {
+            return std::unexpected(PeriodErrc::out_of_range);
+        }
+        return std::expected<BasicTokenBucket, PeriodErrc>{std::in_place, interval, burst};
+    }
+
+    BasicTokenBucket(const BasicTokenBucket &) = delete;
+    BasicTokenBucket &operator=(const BasicTokenBucket &) = delete;
+
+    /// Take `tokens` if available at `now`; never blocks. More tokens than the burst never fit.
+    bool try_acquire(Nanoseconds<std::int64_t> now, std::uint32_t tokens = 1) noexcept
+    {
+        if (tokens > burst_)
+        {
+            return false;
+        }
+        const auto now_ns = now.get();
+        const auto cost = std::int64_t{tokens} * interval_ns_;
+        const auto allowance = std::int64_t{burst_} * interval_ns_;
+        return state_.update([&](std::int64_t tat) -> std::optional<std::int64_t> {
+            const auto next = detail::saturating_add(std::max(tat, now_ns), cost);
+            if (next - now_ns > allowance)
+            {
+                return std::nullopt;
+            }
+            return next;
+        });
+    }
+
+    template <typename T>
+    bool try_acquire(SteadyTimePoint<T> now, std::uint32_t tokens = 1) noexcept
+    {
+        return try_acquire(time_since_origin(now), tokens);
+    }
+
+    bool try_acquire() noexcept
+    {
+        return try_acquire(steady_now_ns());
+    }
+
+    /// How long until `tokens` could be acquired (zero if they are available now); int64 max when
+    /// `tokens` exceeds the burst and can never be acquired
+    [[nodiscard]] Nanoseconds<std::int64_t> retry_after(Nanoseconds<std::int64_t> now,
+                                                       std::uint32_t tokens = 1) const noexcept
+    {
+        if (tokens > burst_)
+        {
+            return Nanoseconds<std::int64_t>{std::numeric_limits<std::int64_t>::max()};
+        }
+        const auto now_ns = now.get();
+        const auto next = detail::saturating_add(std::max(state_.load(), now_ns), std::int64_t{tokens} * interval_ns_);
+        const auto wait = next - now_ns - std::int64_t{burst_} * interval_ns_;
+        return Nanoseconds<std::int64_t>{std::max(wait, std::int64_t{0})};
+    }
+
+    /// Whole tokens available at `now`
+    [[nodiscard]] std::uint32_t available(Nanoseconds<std::int64_t> now) const noexcept
+    {
+        const auto now_ns = now.get();
+        const auto debt = std::max(state_.load(), now_ns) - now_ns;
+        const auto free_ns = std::int64_t{burst_} * interval_ns_ - debt;
+        return free_ns <= 0 ? 0U : static_cast<std::uint32_t>(free_ns / interval_ns_);
+    }
+
+    [[nodiscard]] Nanoseconds<std::int64_t> interval() const noexcept
+    {
+        return Nanoseconds<std::int64_t>{interval_ns_};
+    }
+
+    [[nodiscard]] std::uint32_t burst() const noexcept
+    {
+        return burst_;
+    }
+
+    /// Refill to a full bucket
+    void reset() noexcept
+    {
+        state_.reset();
+    }
+
+private:
+    std::int64_t interval_ns_;
+    std::uint32_t burst_;
+    detail::GcraState<P> state_;
+};
+
+using TokenBucket = BasicTokenBucket<Producers::single>;
+using ConcurrentTokenBucket = BasicTokenBucket<Producers::multi>;
+
+// ---- LeakyBucket: shaper — every admitted request gets a send delay that spaces output at `rate` ----
+
+template <Producers P = Producers::single>
+class BasicLeakyBucket
+{
+public:
+    /// Requests whose delay would exceed `max_delay` (the queue depth in time) are rejected.
+    /// A rate <= 0 Hz is clamped to a 1 ns interval; create() rejects it instead
+    template <typename T, TimeUnit U>
+    BasicLeakyBucket(unit_t<T, HertzTag> rate, U max_delay) noexcept
+        : interval_ns_(detail::period_or_min(period_from_rate(rate))), max_delay_ns_(to_nanoseconds(max_delay).get())
+    {
+    }
+
+    /// An interval <= 0 is clamped to 1 ns
+    template <TimeUnit I, TimeUnit U>
+    BasicLeakyBucket(I interval, U max_delay) noexcept
+        : interval_ns_(std::max(to_nanoseconds(interval).get(), std::int64_t{1})),
+          max_delay_ns_(to_nanoseconds(max_delay).get())
+    {
+    }
+
+    /// Fails like period_from_rate: not_positive for a rate <= 0 Hz, out_of_range for one too slow
+    template <typename T, TimeUnit U>
+    [[nodiscard]] static std::expected<BasicLeakyBucket, PeriodErrc> create(unit_t<T, HertzTag> rate,
+                                                                            U max_delay) noexcept
+    {
+        const auto interval = period_from_rate(rate);
+        if (!interval)
+        {
+            return std::unexpected(interval.error());
+        }
+        return std::expected<BasicLeakyBucket, PeriodErrc>{std::in_place, *interval, max_delay};
+    }
+
+    /// Fails with PeriodErrc::not_positive for an interval <= 0
+    template <TimeUnit I, TimeUnit U>
+    [[nodiscard]] static std::expected<BasicLeakyBucket, PeriodErrc> create(I interval, U max_delay) noexcept
+    {
+        if (to_nanoseconds(interval).get() <= 0)
+        {
+            return std::unexpected(PeriodErrc::not_positive);
+        }
+        return std::expected<BasicLeakyBucket, PeriodErrc>{std::in_place, interval, max_delay};
+    }
+
+    BasicLeakyBucket(const BasicLeakyBucket &) = delete;
+    BasicLeakyBucket &operator=(const BasicLeakyBucket &) = delete;
+
+    /// Reserve a send slot: the delay to wait from `now`, or nullopt when the queue is full
+    std::optional<Nanoseconds<std::int64_t>> reserve(Nanoseconds<std::int64_t> now, std::uint32_t tokens = 1) noexcept
+    {
+        const auto now_ns = now.get();
+        const auto cost = detail::saturating_multiply(std::int64_t{tokens}, interval_ns_);
+        std::int64_t delay = 0;
+        const bool admitted = state_.update([&](std::int64_t tat) -> std::optional<std::int64_t> {
+            const auto start = std::max(tat, now_ns);
+            delay = start - now_ns;
+            if (delay > max_delay_ns_)
+            {
+                return std::nullopt;
+            }
+            return detail::saturating_add(start, cost);
+        });
+        if (!admitted)
+        {
+            return std::nullopt;
+        }
+        return Nanoseconds<std::int64_t>{delay};
+    }
+
+    template <typename T>
+    std::optional<Nanoseconds<std::int64_t>> reserve(SteadyTimePoint<T> now, std::uint32_t tokens = 1) noexcept
+    {
+        return reserve(time_since_origin(now), tokens);
+    }
+
+    std::optional<Nanoseconds<std::int64_t>> reserve() noexcept
+    {
+        return reserve(steady_now_ns());
+    }
+
+    /// Current queue depth expressed as the delay a new request would get
+    [[nodiscard]] Nanoseconds<std::int64_t> backlog(Nanoseconds<std::int64_t> now) const noexcept
+    {
+        return Nanoseconds<std::int64_t>{std::max(state_.load(), now.get()) - now.get()};
+    }
+
+    [[nodiscard]] Nanoseconds<std::int64_t> interval() const noexcept
+    {
+        return Nanoseconds<std::int64_t>{interval_ns_};
+    }
+
+    void reset() noexcept
+    {
+        state_.reset();
+    }
+
+private:
+    std::int64_t interval_ns_;
+    std::int64_t max_delay_ns_;
+    detail::GcraState<P> state_;
+};
+
+using LeakyBucket = BasicLeakyBucket<Producers::single>;
+using ConcurrentLeakyBucket = BasicLeakyBucket<Producers::multi>;
+
+} // namespace strong_types
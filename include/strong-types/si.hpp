@@ -2,9 +2,41 @@
 
 #include "strong.hpp"
 
+// Opt in with -DSTRONG_TYPES_DIMENSION_ENGINE=1: the named tags become Dimension aliases and every
+// product/quotient is derived from exponents instead of the hand-written tables below
+#ifndef STRONG_TYPES_DIMENSION_ENGINE
+#define STRONG_TYPES_DIMENSION_ENGINE 0
+#endif
+
+#if STRONG_TYPES_DIMENSION_ENGINE
+#include "dimension.hpp"
+#endif
+
 namespace strong_types
 {
 
+#if STRONG_TYPES_DIMENSION_ENGINE
+    // SI tags as exponent vectors: products and quotients come from dimension.hpp
+    using LengthTag = dim::Length;
+    using MassTag = dim::Mass;
+    using TimeTag = dim::Time;
+    using AreaTag = dim::Area;
+    using SpeedTag = dim::Speed;
+    using AccelerationTag = dim::Acceleration;
+    using ForceTag = dim::Force;
+    using EnergyTag = dim::Energy;
+    using HertzTag = dim::Frequency;
+    using CelsiusTag = dim::Temperature;
+    using VoltTag = dim::Voltage;
+    using RadianTag = dim::Angle;
+    using SteradianTag = dim::SolidAngle;
+    using PowerTag = dim::Power;
+    using PressureTag = dim::Pressure;
+    using AngularVelocityTag = dim::AngularVelocity;
+    using VolumeTag = dim::Volume;
+    using DensityTag = dim::Density;
+    using TorqueTag = dim::Torque;
+#else
     // SI base + derived tags
     struct LengthTag;
     struct MassTag;
@@ -25,11 +57,13 @@ namespace strong_types
     struct VolumeTag;
     struct DensityTag;
     struct TorqueTag;
+#endif
 
     // alias
     template <typename T, typename Tag>
     using unit_t = Strong<T, Tag>;
 
+#if !STRONG_TYPES_DIMENSION_ENGINE
     // --- tag-level traits ---
     template <typename L, typename R>
     struct tag_sum_result;
@@ -257,5 +291,12 @@ namespace strong_types
     {
         using type = AngularVelocityTag;
     };
+#endif // !STRONG_TYPES_DIMENSION_ENGINE
 
 } // namespace strong_types
+
+// Opt-in extern template declarations for the compiled companion library (see extern_templates.hpp)
+#if STRONG_TYPES_EXTERN_TEMPLATES
+#include "extern_templates.hpp"
+STRONG_TYPES_INSTANTIATE_SI_UNITS(extern template)
+#endif
@@ -3,7 +3,9 @@
 #include "si_scaled.hpp"
 
 #include <chrono>
+#include <cstdint>
 #include <ctime>
+#include <ratio>
 
 #if __has_include(<sys/time.h>)
 #include <sys/time.h>
@@ -21,6 +23,49 @@ template <typename U>
 concept TimeUnit = (is_strong_v<U> && std::is_same_v<typename U::tag_type, TimeTag>) ||
                    (is_scaled_v<U> && std::is_same_v<typename U::tag_type, TimeTag>);
 
+// ---- time_unit_ratio: scale of a TimeUnit relative to seconds ----
+
+template <typename U>
+struct time_unit_ratio
+{
+    using type = std::ratio<1>;
+};
+
+template <typename T, typename R>
+struct time_unit_ratio<ScaledUnit<T, TimeTag, R>>
+{
+    using type = R;
+};
+
+// ---- to_nanoseconds: any TimeUnit → Nanoseconds<int64_t> (rounded to nearest) ----
+
+template <TimeUnit U>
+[[nodiscard]] constexpr Nanoseconds<std::int64_t> to_nanoseconds(U val) noexcept
+{
+    using T = typename U::value_type;
+    using F = std::ratio_divide<typename time_unit_ratio<U>::type, std::nano>;
+
+    if constexpr (std::is_integral_v<T> && F::den == 1)
+    {
+        // Exact: integer ticks times an integer factor, no floating-point round trip
+        std::int64_t ticks = 0;
+        if constexpr (std::is_same_v<T, std::int64_t>)
+        {
+            ticks = val.get();
+        }
+        else
+        {
+            ticks = static_cast<std::int64_t>(val.get());
+        }
+        return Nanoseconds<std::int64_t>{ticks * std::int64_t{F::num}};
+    }
+    else
+    {
+        auto ns = static_cast<double>(val.get()) * static_cast<double>(F::num) / static_cast<double>(F::den);
+        return Nanoseconds<std::int64_t>{static_cast<std::int64_t>(ns >= 0.0 ? ns + 0.5 : ns - 0.5)};
+    }
+}
+
 // ---- from_chrono: chrono::duration → unit_t<double, TimeTag> (seconds) ----
 
 template <typename Rep, typename Period>
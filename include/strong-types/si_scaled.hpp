@@ -1,7 +1,9 @@
 #pragma once
 
 #include "si.hpp"
+#include <numeric>
 #include <ratio>
+#include <utility>
 
 namespace strong_types
 {
@@ -31,7 +33,7 @@ struct ScaledUnit
     }
 
     template <typename U>
-        requires(!std::same_as<std::remove_cvref_t<U>, T>)
+        requires(!std::same_as<std::remove_cvref_t<U>, T> && !std::same_as<std::remove_cvref_t<U>, ScaledUnit>)
     explicit ScaledUnit(U && /*unused*/) // NOLINT(cppcoreguidelines-missing-std-forward,google-explicit-constructor)
     {
         static_assert(always_false_v<U>,
@@ -75,6 +77,32 @@ inline constexpr bool is_scaled_v<ScaledUnit<T, Tag, R>> = true;
 template <typename A, typename B>
 concept SameTagScaled = is_scaled_v<A> && is_scaled_v<B> && std::is_same_v<typename A::tag_type, typename B::tag_type>;
 
+// ---- common_ratio_t: largest ratio every operand ratio is a whole multiple of ----
+
+namespace detail
+{
+
+template <typename... Rs>
+struct common_ratio;
+
+template <typename R>
+struct common_ratio<R>
+{
+    using type = std::ratio<(R::num < 0 ? -R::num : R::num), R::den>;
+};
+
+template <typename R1, typename R2, typename... Rs>
+struct common_ratio<R1, R2, Rs...>
+{
+    using type = typename common_ratio<std::ratio<std::gcd(R1::num, R2::num), std::lcm(R1::den, R2::den)>, Rs...>::type;
+};
+
+} // namespace detail
+
+/// e.g. common_ratio_t<std::kilo, std::centi> = std::centi; gcd of numerators over lcm of denominators
+template <typename... Rs>
+using common_ratio_t = typename detail::common_ratio<Rs...>::type;
+
 // ---- scale_cast: base unit_t → ScaledUnit (implicitly ratio<1>) ----
 
 template <typename TargetScaled, typename T, typename Tag>
@@ -124,20 +152,67 @@ template <typename T, typename Tag, typename R>
     return ScaledUnit<T, Tag, R>{lhs.get() - rhs.get()};
 }
 
-// ---- cross-scale add/sub (same tag, different ratio -> base) ----
+// ---- cross-scale add/sub (same tag, different ratio -> common ratio, like std::chrono::common_type) ----
+//
+// Both operands are rescaled to common_ratio_t of their ratios. Each factor is a whole number, so
+// integer operands are combined exactly with one multiply per operand and no division.
+
+namespace detail
+{
+
+/// Whether the whole factor N (or -N, for a subtracted operand) converts to T without changing value
+template <typename T, std::intmax_t N>
+[[nodiscard]] consteval bool factor_fits() noexcept
+{
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        return true;
+    }
+    else
+    {
+        return std::in_range<T>(N < 0 ? -N : N);
+    }
+}
+
+template <typename C, typename S>
+inline constexpr bool fits_common_ratio_v =
+    factor_fits<typename S::value_type, std::ratio_divide<typename S::ratio_type, C>::num>();
+
+template <typename C, typename S>
+[[nodiscard]] constexpr typename S::value_type at_common_ratio(const S &val) noexcept
+{
+    using F = std::ratio_divide<typename S::ratio_type, C>;
+    static_assert(F::den == 1, "common ratio divides every operand ratio");
+    static_assert(fits_common_ratio_v<C, S>, "conversion factor to the common ratio does not fit the value type");
+    return val.get() * static_cast<typename S::value_type>(F::num);
+}
+
+} // namespace detail
+
+/// False when LHS ± RHS would need a conversion factor wider than an operand's value type, e.g.
+/// Hours<std::int32_t> + Nanoseconds<std::int32_t> (3.6e12 ns per hour); such expressions do not compile
+template <typename LHS, typename RHS>
+    requires SameTagScaled<LHS, RHS>
+inline constexpr bool common_ratio_representable_v =
+    detail::fits_common_ratio_v<common_ratio_t<typename LHS::ratio_type, typename RHS::ratio_type>, LHS> &&
+    detail::fits_common_ratio_v<common_ratio_t<typename LHS::ratio_type, typename RHS::ratio_type>, RHS>;
 
 template <typename LHS, typename RHS>
     requires SameTagScaled<LHS, RHS> && (!std::is_same_v<typename LHS::ratio_type, typename RHS::ratio_type>)
 [[nodiscard]] constexpr auto operator+(const LHS &lhs, const RHS &rhs)
 {
-    return lhs.to_base() + rhs.to_base();
+    using C = common_ratio_t<typename LHS::ratio_type, typename RHS::ratio_type>;
+    return ScaledUnit<typename LHS::value_type, typename LHS::tag_type, C>{detail::at_common_ratio<C>(lhs) +
+                                                                           detail::at_common_ratio<C>(rhs)};
 }
 
 template <typename LHS, typename RHS>
     requires SameTagScaled<LHS, RHS> && (!std::is_same_v<typename LHS::ratio_type, typename RHS::ratio_type>)
 [[nodiscard]] constexpr auto operator-(const LHS &lhs, const RHS &rhs)
 {
-    return lhs.to_base() - rhs.to_base();
+    using C = common_ratio_t<typename LHS::ratio_type, typename RHS::ratio_type>;
+    return ScaledUnit<typename LHS::value_type, typename LHS::tag_type, C>{detail::at_common_ratio<C>(lhs) -
+                                                                           detail::at_common_ratio<C>(rhs)};
 }
 
 // ---- scaled +/- base unit_t (same tag -> base) ----
@@ -302,3 +377,9 @@ template <typename T>
 using KilometersPerHour = ScaledUnit<T, SpeedTag, std::ratio<5, 18>>; // NOLINT(readability-magic-numbers)
 
 } // namespace strong_types
+
+// Opt-in extern template declarations for the compiled companion library (see extern_templates.hpp)
+#if STRONG_TYPES_EXTERN_TEMPLATES
+#include "extern_templates.hpp"
+STRONG_TYPES_INSTANTIATE_SCALED_UNITS(extern template)
+#endif
@@ -0,0 +1,292 @@
+#pragma once
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace strong_types
+{
+
+// ---- Generational slot map ----
+//
+// A raw index stays valid after its entity is destroyed and the slot is reused (the ABA problem).
+// SlotMap hands out SlotHandle<Tag>: a 32-bit slot index and the slot's 32-bit generation at insert
+// time. Erasing bumps the generation, so every older handle to that slot stops resolving.
+//
+// Layout:
+//   * values_ / owners_: the elements, packed densely, plus the slot that owns each one. Erase
+//     moves the last element into the hole, so iteration is a plain walk over a contiguous array.
+//   * slots_: per slot, the element's dense position (occupied) or the next free slot (free), and
+//     the generation. An odd generation marks an occupied slot, and handles only carry odd ones.
+//     Free slots form an intrusive list threaded through slots_, so insert and erase allocate
+//     only when the vectors grow; reserve() removes even that.
+//
+//   SlotMap<Body, struct BodyTag> bodies;
+//   const auto h = bodies.insert(Body{...});
+//   bodies.erase(h);
+//   bodies.find(h);   // nullptr, even after the slot is reused
+
+template <typename Tag>
+class SlotHandle
+{
+public:
+    using tag_type = Tag;
+
+    /// Default-constructed handles resolve to nothing
+    constexpr SlotHandle() noexcept = default;
+
+    constexpr SlotHandle(std::uint32_t index, std::uint32_t generation) noexcept : index_(index), generation_(generation)
+    {
+    }
+
+    [[nodiscard]] constexpr std::uint32_t index() const noexcept
+    {
+        return index_;
+    }
+
+    [[nodiscard]] constexpr std::uint32_t generation() const noexcept
+    {
+        return generation_;
+    }
+
+    /// Live slots have odd generations; this says nothing about whether the element still exists
+    [[nodiscard]] constexpr bool is_valid() const noexcept
+    {
+        return (generation_ & 1U) != 0;
+    }
+
+    /// Index and generation in one word, for wire formats and hashing
+    [[nodiscard]] constexpr std::uint64_t bits() const noexcept
+    {
+        return (std::uint64_t{generation_} << 32U) | index_;
+    }
+
+    [[nodiscard]] static constexpr SlotHandle from_bits(std::uint64_t bits) noexcept
+    {
+        return SlotHandle{static_cast<std::uint32_t>(bits), static_cast<std::uint32_t>(bits >> 32U)};
+    }
+
+    [[nodiscard]] constexpr bool operator==(const SlotHandle &) const noexcept = default;
+    [[nodiscard]] constexpr auto operator<=>(const SlotHandle &) const noexcept = default;
+
+private:
+    std::uint32_t index_ = std::numeric_limits<std::uint32_t>::max();
+    std::uint32_t generation_ = 0;
+};
+
+static_assert(sizeof(SlotHandle<void>) == sizeof(std::uint64_t));
+
+template <typename T, typename Tag>
+class SlotMap
+{
+public:
+    using value_type = T;
+    using handle_type = SlotHandle<Tag>;
+    using size_type = std::size_t;
+    using iterator = typename std::vector<T>::iterator;
+    using const_iterator = typename std::vector<T>::const_iterator;
+
+    constexpr SlotMap() = default;
+
+    [[nodiscard]] constexpr size_type size() const noexcept
+    {
+        return values_.size();
+    }
+
+    [[nodiscard]] constexpr bool empty() const noexcept
+    {
+        return values_.empty();
+    }
+
+    /// Slots ever created, live or free
+    [[nodiscard]] constexpr size_type slot_count() const noexcept
+    {
+        return slots_.size();
+    }
+
+    /// Capacity for `count` live elements, so that many inserts never allocate
+    constexpr void reserve(size_type count)
+    {
+        values_.reserve(count);
+        owners_.reserve(count);
+        slots_.reserve(count);
+    }
+
+    constexpr handle_type insert(const T &value)
+    {
+        return emplace(value);
+    }
+
+    constexpr handle_type insert(T &&value)
+    {
+        return emplace(std::move(value));
+    }
+
+    /// Strong guarantee: the bookkeeping vectors grow before the element is constructed, so if
+    /// either allocation or T's constructor throws, the map is left unchanged
+    template <typename... Args>
+    constexpr handle_type emplace(Args &&...args)
+    {
+        make_room(owners_);
+        if (free_head_ == NO_SLOT)
+        {
+            make_room(slots_);
+        }
+        values_.emplace_back(std::forward<Args>(args)...);
+        const auto dense = static_cast<std::uint32_t>(values_.size() - 1);
+
+        // Neither push_back below can reallocate, so nothing after the emplace throws
+        std::uint32_t index = free_head_;
+        if (index == NO_SLOT)
+        {
+            index = static_cast<std::uint32_t>(slots_.size());
+            slots_.push_back(Slot{});
+        }
+        else
+        {
+            free_head_ = slots_[index].link;
+        }
+
+        Slot &slot = slots_[index];
+        slot.link = dense;
+        ++slot.generation; // even -> odd: occupied
+        owners_.push_back(index);
+        return handle_type{index, slot.generation};
+    }
+
+    /// False when `handle` no longer refers to an element
+    constexpr bool erase(handle_type handle)
+    {
+        if (!contains(handle))
+        {
+            return false;
+        }
+        Slot &slot = slots_[handle.index()];
+        const std::uint32_t dense = slot.link;
+        const std::uint32_t last = static_cast<std::uint32_t>(values_.size() - 1);
+        if (dense != last)
+        {
+            values_[dense] = std::move(values_[last]);
+            owners_[dense] = owners_[last];
+            slots_[owners_[dense]].link = dense;
+        }
+        values_.pop_back();
+        owners_.pop_back();
+
+        ++slot.generation; // odd -> even: free
+        slot.link = free_head_;
+        free_head_ = handle.index();
+        return true;
+    }
+
+    /// Erases every element and invalidates every outstanding handle; keeps the capacity
+    constexpr void clear() noexcept
+    {
+        for (const std::uint32_t index : owners_)
+        {
+            Slot &slot = slots_[index];
+            ++slot.generation;
+            slot.link = free_head_;
+            free_head_ = index;
+        }
+        values_.clear();
+        owners_.clear();
+    }
+
+    [[nodiscard]] constexpr bool contains(handle_type handle) const noexcept
+    {
+        return handle.index() < slots_.size() && slots_[handle.index()].generation == handle.generation() &&
+               handle.is_valid();
+    }
+
+    /// nullptr when `handle` is stale or was never issued by this map
+    [[nodiscard]] constexpr T *find(handle_type handle) noexcept
+    {
+        return contains(handle) ? std::addressof(values_[slots_[handle.index()].link]) : nullptr;
+    }
+
+    [[nodiscard]] constexpr const T *find(handle_type handle) const noexcept
+    {
+        return contains(handle) ? std::addressof(values_[slots_[handle.index()].link]) : nullptr;
+    }
+
+    /// Unchecked: `handle` must be live
+    [[nodiscard]] constexpr T &operator[](handle_type handle) noexcept
+    {
+        return values_[slots_[handle.index()].link];
+    }
+
+    [[nodiscard]] constexpr const T &operator[](handle_type handle) const noexcept
+    {
+        return values_[slots_[handle.index()].link];
+    }
+
+    /// Handle of the element at dense position `position` (0 <= position < size())
+    [[nodiscard]] constexpr handle_type handle_at(size_type position) const noexcept
+    {
+        const std::uint32_t index = owners_[position];
+        return handle_type{index, slots_[index].generation};
+    }
+
+    /// The live elements, densely packed, in no particular order
+    [[nodiscard]] constexpr std::span<T> values() noexcept
+    {
+        return values_;
+    }
+
+    [[nodiscard]] constexpr std::span<const T> values() const noexcept
+    {
+        return values_;
+    }
+
+    [[nodiscard]] constexpr iterator begin() noexcept
+    {
+        return values_.begin();
+    }
+
+    [[nodiscard]] constexpr iterator end() noexcept
+    {
+        return values_.end();
+    }
+
+    [[nodiscard]] constexpr const_iterator begin() const noexcept
+    {
+        return values_.begin();
+    }
+
+    [[nodiscard]] constexpr const_iterator end() const noexcept
+    {
+        return values_.end();
+    }
+
+private:
+    static constexpr std::uint32_t NO_SLOT = std::numeric_limits<std::uint32_t>::max();
+
+    struct Slot
+    {
+        std::uint32_t link = 0; // dense position when occupied, next free slot when free
+        std::uint32_t generation = 0;
+    };
+
+    /// Capacity for one more element, grown geometrically so appends stay amortized O(1)
+    template <typename V>
+    static constexpr void make_room(std::vector<V> &vec)
+    {
+        if (vec.size() == vec.capacity())
+        {
+            vec.reserve(vec.empty() ? 1 : 2 * vec.size());
+        }
+    }
+
+    std::vector<T> values_;
+    std::vector<std::uint32_t> owners_;
+    std::vector<Slot> slots_;
+    std::uint32_t free_head_ = NO_SLOT;
+};
+
+} // namespace strong_types
@@ -0,0 +1,432 @@
+#pragma once
+
+#include "strong.hpp"
+#include "unit_span.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace strong_types
+{
+
+// ---- soa_vector: structure-of-arrays records of quantities ----
+//
+// soa_vector<SteadyTimePoint, Meters, Meters, Speed> keeps one contiguous, 64-byte-aligned column
+// of raw value_type per field. A scan over one field touches only that column's cache lines. The
+// columns are exposed as QuantitySpan, so the span algorithms (sum, mean, minmax, convert) apply
+// directly, and scale / filter run as plain loops over each column. Rows are proxies: row.get<I>()
+// (or a structured binding) yields a QuantityRef into column I.
+
+inline constexpr std::size_t SOA_COLUMN_ALIGNMENT = 64;
+
+namespace detail
+{
+
+template <typename T>
+struct ColumnAllocator
+{
+    using value_type = T;
+
+    constexpr ColumnAllocator() noexcept = default;
+
+    template <typename U>
+    constexpr ColumnAllocator(const ColumnAllocator<U> & /*unused*/) noexcept // NOLINT(google-explicit-constructor)
+    {
+    }
+
+    [[nodiscard]] T *allocate(std::size_t count)
+    {
+        return static_cast<T *>(::operator new(count * sizeof(T), std::align_val_t{SOA_COLUMN_ALIGNMENT}));
+    }
+
+    void deallocate(T *ptr, std::size_t /*count*/) noexcept
+    {
+        ::operator delete(ptr, std::align_val_t{SOA_COLUMN_ALIGNMENT});
+    }
+
+    template <typename U>
+    [[nodiscard]] constexpr bool operator==(const ColumnAllocator<U> & /*unused*/) const noexcept
+    {
+        return true;
+    }
+};
+
+template <typename Field>
+using Column = std::vector<typename Field::value_type, ColumnAllocator<typename Field::value_type>>;
+
+} // namespace detail
+
+/// One row of a soa_vector: pointers to the row's slot in every column
+template <bool Const, typename... Fields>
+class SoaRow
+{
+    template <typename F>
+    using slot_t = std::conditional_t<Const, const typename F::value_type, typename F::value_type>;
+
+public:
+    using record = std::tuple<Fields...>;
+
+    constexpr explicit SoaRow(slot_t<Fields> *...slots) noexcept : slots_(slots...)
+    {
+    }
+
+    /// Field I: a QuantityRef into its column, or the value for a const row
+    template <std::size_t I>
+    [[nodiscard]] constexpr auto get() const noexcept
+    {
+        using F = std::tuple_element_t<I, record>;
+        if constexpr (Const)
+        {
+            return std::bit_cast<F>(*std::get<I>(slots_));
+        }
+        else
+        {
+            return QuantityRef<F, typename F::value_type>{*std::get<I>(slots_)};
+        }
+    }
+
+    constexpr operator record() const noexcept // NOLINT(google-explicit-constructor)
+    {
+        return std::apply([](const auto *...slot) { return record{std::bit_cast<Fields>(*slot)...}; }, slots_);
+    }
+
+    /// Writes every field of `values` into the row
+    constexpr const SoaRow &assign(const record &values) const noexcept
+        requires(!Const)
+    {
+        assign_fields(values, std::index_sequence_for<Fields...>{});
+        return *this;
+    }
+
+private:
+    template <std::size_t... I>
+    constexpr void assign_fields(const record &values, std::index_sequence<I...> /*unused*/) const noexcept
+    {
+        ((*std::get<I>(slots_) = std::get<I>(values).get()), ...);
+    }
+
+    std::tuple<slot_t<Fields> *...> slots_;
+};
+
+template <bool Const, typename... Fields>
+class SoaIterator
+{
+    template <typename F>
+    using slot_t = std::conditional_t<Const, const typename F::value_type, typename F::value_type>;
+
+public:
+    using iterator_concept = std::random_access_iterator_tag;
+    using iterator_category = std::input_iterator_tag; // rows are proxies
+    using value_type = std::tuple<Fields...>;
+    using difference_type = std::ptrdiff_t;
+    using reference = SoaRow<Const, Fields...>;
+
+    constexpr SoaIterator() noexcept = default;
+
+    constexpr SoaIterator(std::tuple<slot_t<Fields> *...> columns, std::size_t index) noexcept
+        : columns_(columns), index_(static_cast<difference_type>(index))
+    {
+    }
+
+    [[nodiscard]] constexpr reference operator*() const noexcept
+    {
+        return (*this)[0];
+    }
+
+    [[nodiscard]] constexpr reference operator[](difference_type offset) const noexcept
+    {
+        const auto row = index_ + offset;
+        return std::apply([row](auto *...column) { return reference{(column + row)...}; }, columns_);
+    }
+
+    constexpr SoaIterator &operator++() noexcept
+    {
+        ++index_;
+        return *this;
+    }
+
+    constexpr SoaIterator operator++(int) noexcept
+    {
+        auto prev = *this;
+        ++index_;
+        return prev;
+    }
+
+    constexpr SoaIterator &operator--() noexcept
+    {
+        --index_;
+        return *this;
+    }
+
+    constexpr SoaIterator operator--(int) noexcept
+    {
+        auto prev = *this;
+        --index_;
+        return prev;
+    }
+
+    constexpr SoaIterator &operator+=(difference_type offset) noexcept
+    {
+        index_ += offset;
+        return *this;
+    }
+
+    constexpr SoaIterator &operator-=(difference_type offset) noexcept
+    {
+        index_ -= offset;
+        return *this;
+    }
+
+    [[nodiscard]] friend constexpr SoaIterator operator+(SoaIterator it, difference_type offset) noexcept
+    {
+        return it += offset;
+    }
+
+    [[nodiscard]] friend constexpr SoaIterator operator+(difference_type offset, SoaIterator it) noexcept
+    {
+        return it += offset;
+    }
+
+    [[nodiscard]] friend constexpr SoaIterator operator-(SoaIterator it, difference_type offset) noexcept
+    {
+        return it -= offset;
+    }
+
+    [[nodiscard]] friend constexpr difference_type operator-(const SoaIterator &lhs, const SoaIterator &rhs) noexcept
+    {
+        return lhs.index_ - rhs.index_;
+    }
+
+    [[nodiscard]] constexpr bool operator==(const SoaIterator &rhs) const noexcept
+    {
+        return index_ == rhs.index_;
+    }
+
+    [[nodiscard]] constexpr auto operator<=>(const SoaIterator &rhs) const noexcept
+    {
+        return index_ <=> rhs.index_;
+    }
+
+private:
+    std::tuple<slot_t<Fields> *...> columns_{};
+    difference_type index_{};
+};
+
+template <typename... Fields>
+    requires(sizeof...(Fields) > 0 && (ValueLayout<Fields> && ...))
+class soa_vector
+{
+public:
+    using record = std::tuple<Fields...>;
+    using size_type = std::size_t;
+    using reference = SoaRow<false, Fields...>;
+    using const_reference = SoaRow<true, Fields...>;
+    using iterator = SoaIterator<false, Fields...>;
+    using const_iterator = SoaIterator<true, Fields...>;
+
+    template <std::size_t I>
+    using field_type = std::tuple_element_t<I, record>;
+
+    static constexpr std::size_t COLUMNS = sizeof...(Fields);
+
+    soa_vector() = default;
+
+    [[nodiscard]] size_type size() const noexcept
+    {
+        return std::get<0>(columns_).size();
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    void reserve(size_type count)
+    {
+        std::apply([count](auto &...column) { (column.reserve(count), ...); }, columns_);
+    }
+
+    /// New rows are value-initialized (zero). Every column is reserved first, so a failed allocation
+    /// leaves all of them at the old size.
+    void resize(size_type count)
+    {
+        reserve(count);
+        std::apply([count](auto &...column) { (column.resize(count), ...); }, columns_);
+    }
+
+    void clear() noexcept
+    {
+        std::apply([](auto &...column) { (column.clear(), ...); }, columns_);
+    }
+
+    /// Strong guarantee: capacity for the new row is reserved in every column before any column grows
+    void push_back(const Fields &...values)
+    {
+        if (const size_type count = size(); count == capacity())
+        {
+            reserve(count == 0 ? 1 : 2 * count);
+        }
+        push_fields(std::index_sequence_for<Fields...>{}, values...);
+    }
+
+    void push_back(const record &values)
+    {
+        std::apply([this](const auto &...field) { push_back(field...); }, values);
+    }
+
+    void pop_back() noexcept
+    {
+        std::apply([](auto &...column) { (column.pop_back(), ...); }, columns_);
+    }
+
+    [[nodiscard]] reference operator[](size_type index) noexcept
+    {
+        return begin()[static_cast<std::ptrdiff_t>(index)];
+    }
+
+    [[nodiscard]] const_reference operator[](size_type index) const noexcept
+    {
+        return begin()[static_cast<std::ptrdiff_t>(index)];
+    }
+
+    [[nodiscard]] iterator begin() noexcept
+    {
+        return iterator{column_pointers(), 0};
+    }
+
+    [[nodiscard]] iterator end() noexcept
+    {
+        return iterator{column_pointers(), size()};
+    }
+
+    [[nodiscard]] const_iterator begin() const noexcept
+    {
+        return const_iterator{column_pointers(), 0};
+    }
+
+    [[nodiscard]] const_iterator end() const noexcept
+    {
+        return const_iterator{column_pointers(), size()};
+    }
+
+    // ---- columns ----
+
+    template <std::size_t I>
+    [[nodiscard]] QuantitySpan<field_type<I>> column() noexcept
+    {
+        auto &raw = std::get<I>(columns_);
+        return QuantitySpan<field_type<I>>{raw.data(), raw.size()};
+    }
+
+    template <std::size_t I>
+    [[nodiscard]] QuantitySpan<field_type<I>, const typename field_type<I>::value_type> column() const noexcept
+    {
+        const auto &raw = std::get<I>(columns_);
+        return QuantitySpan<field_type<I>, const typename field_type<I>::value_type>{raw.data(), raw.size()};
+    }
+
+    /// Multiplies column I by `factor` in place (fields whose `field * factor` keeps the type)
+    template <std::size_t I, Scalar S>
+        requires requires(const field_type<I> &field, S factor) {
+            { field * factor } -> std::same_as<field_type<I>>;
+        }
+    void scale(S factor) noexcept
+    {
+        using F = field_type<I>;
+        for (auto &value : std::get<I>(columns_))
+        {
+            value = (std::bit_cast<F>(value) * factor).get();
+        }
+    }
+
+    /// Rows whose field I satisfies `pred`. One pass builds a byte mask from column I; each column
+    /// is then compacted through the mask on its own, so every pass is a linear scan.
+    template <std::size_t I, typename Pred>
+        requires std::predicate<Pred &, field_type<I>>
+    [[nodiscard]] soa_vector filter(Pred pred) const
+    {
+        const auto &key = std::get<I>(columns_);
+        std::vector<std::uint8_t> mask(key.size());
+        size_type kept = 0;
+        for (size_type row = 0; row < key.size(); ++row)
+        {
+            const bool keep = pred(std::bit_cast<field_type<I>>(key[row]));
+            mask[row] = static_cast<std::uint8_t>(keep);
+            kept += static_cast<size_type>(keep);
+        }
+
+        soa_vector result;
+        result.reserve(kept);
+        compact_into(result, mask, std::index_sequence_for<Fields...>{});
+        return result;
+    }
+
+private:
+    /// Smallest column capacity: rows that fit in every column without reallocating
+    [[nodiscard]] size_type capacity() const noexcept
+    {
+        return std::apply([](const auto &...column) { return std::min({column.capacity()...}); }, columns_);
+    }
+
+    template <std::size_t... I>
+    void push_fields(std::index_sequence<I...> /*unused*/, const Fields &...values)
+    {
+        (std::get<I>(columns_).push_back(values.get()), ...);
+    }
+
+    [[nodiscard]] auto column_pointers() noexcept
+    {
+        return std::apply([](auto &...column) { return std::tuple{column.data()...}; }, columns_);
+    }
+
+    [[nodiscard]] auto column_pointers() const noexcept
+    {
+        return std::apply([](const auto &...column) { return std::tuple{column.data()...}; }, columns_);
+    }
+
+    template <std::size_t... I>
+    void compact_into(soa_vector &result, const std::vector<std::uint8_t> &mask,
+                      std::index_sequence<I...> /*unused*/) const
+    {
+        (compact_column(std::get<I>(columns_), std::get<I>(result.columns_), mask), ...);
+    }
+
+    template <typename ColumnT>
+    static void compact_column(const ColumnT &src, ColumnT &dst, const std::vector<std::uint8_t> &mask)
+    {
+        for (size_type row = 0; row < src.size(); ++row)
+        {
+            if (mask[row] != 0)
+            {
+                dst.push_back(src[row]);
+            }
+        }
+    }
+
+    std::tuple<detail::Column<Fields>...> columns_;
+};
+
+} // namespace strong_types
+
+// ---- structured bindings: auto [t, x, y, v] = soa[i]; ----
+
+template <bool Const, typename... Fields>
+struct std::tuple_size<strong_types::SoaRow<Const, Fields...>> : std::integral_constant<std::size_t, sizeof...(Fields)>
+{
+};
+
+template <std::size_t I, bool Const, typename... Fields>
+struct std::tuple_element<I, strong_types::SoaRow<Const, Fields...>>
+{
+    using type = decltype(std::declval<const strong_types::SoaRow<Const, Fields...> &>().template get<I>());
+};
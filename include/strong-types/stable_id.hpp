@@ -0,0 +1,201 @@
+#pragma once
+
+#include "dimension.hpp"
+#include "quantity_point.hpp"
+#include "si.hpp"
+#include "si_scaled.hpp"
+#include "unit_suffix.hpp"
+
+#include <cstdint>
+#include <ratio>
+#include <string_view>
+#include <type_traits>
+
+namespace strong_types
+{
+
+// ---- Stable 64-bit IDs for tags, ratios, origins and whole quantity types ----
+//
+// Tags are usually incomplete types, so a quantity's dimension cannot be recovered at run time
+// without RTTI. These IDs are FNV-1a hashes of names and numbers only, never of compiler-specific
+// type names. They stay the same across compilers, builds and the STRONG_TYPES_DIMENSION_ENGINE
+// switch, so they can be used as switch labels, keys in type-erased containers and fields in
+// binary headers.
+//
+//   * tag:    tag_name<Tag> (defaults to tag_suffix), else the exponents of a Dimension tag
+//   * ratio:  numerator and denominator
+//   * origin: origin_name<Origin> (defaults to Origin::name); `void` has ID 0
+//
+// Tags and origins without a name are registered at global scope:
+//   STRONG_TYPES_REGISTER_TAG(app::PixelTag, "px");
+//   STRONG_TYPES_REGISTER_ORIGIN(app::GpsEpoch, "gps_epoch");
+
+using StableId = std::uint64_t;
+
+// ---- names ----
+
+template <typename Tag>
+struct tag_name
+{
+    static constexpr std::string_view value = tag_suffix<Tag>::value;
+};
+
+/// Dimensionless results (e.g. m / m) use the `void` tag
+template <>
+struct tag_name<void>
+{
+    static constexpr std::string_view value = "1";
+};
+
+template <typename Origin>
+struct origin_name
+{
+    static constexpr std::string_view value = "";
+};
+
+template <typename Origin>
+    requires requires { std::string_view{Origin::name}; }
+struct origin_name<Origin>
+{
+    static constexpr std::string_view value = Origin::name;
+};
+
+// NOLINTBEGIN(cppcoreguidelines-macro-usage) — explicit specialization from user code at global scope
+#define STRONG_TYPES_REGISTER_TAG(Tag, name_literal)                                                                   \
+    template <>                                                                                                        \
+    struct strong_types::tag_name<Tag>                                                                                 \
+    {                                                                                                                  \
+        static constexpr std::string_view value = name_literal;                                                        \
+    }
+
+#define STRONG_TYPES_REGISTER_ORIGIN(Origin, name_literal)                                                             \
+    template <>                                                                                                        \
+    struct strong_types::origin_name<Origin>                                                                           \
+    {                                                                                                                  \
+        static constexpr std::string_view value = name_literal;                                                        \
+    }
+// NOLINTEND(cppcoreguidelines-macro-usage)
+
+// ---- hashing ----
+
+namespace detail
+{
+
+inline constexpr std::uint64_t FNV_OFFSET = 14695981039346656037ULL;
+inline constexpr std::uint64_t FNV_PRIME = 1099511628211ULL;
+
+[[nodiscard]] constexpr std::uint64_t fnv1a64(std::string_view text, std::uint64_t hash = FNV_OFFSET) noexcept
+{
+    for (const char c : text)
+    {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+/// Feeds `value` as 8 little-endian bytes, independent of the host byte order
+[[nodiscard]] constexpr std::uint64_t fnv1a64(std::uint64_t value, std::uint64_t hash) noexcept
+{
+    for (int byte = 0; byte < 8; ++byte)
+    {
+        hash ^= (value >> (8 * byte)) & 0xFFU;
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+template <typename Tag>
+[[nodiscard]] consteval std::uint64_t compute_tag_id() noexcept
+{
+    constexpr auto name = tag_name<Tag>::value;
+    if constexpr (!name.empty())
+    {
+        return fnv1a64(name, fnv1a64("tag:"));
+    }
+    else if constexpr (is_dimension_v<Tag>)
+    {
+        auto hash = fnv1a64("dim:");
+        for (const int exponent : {Tag::length, Tag::mass, Tag::time, Tag::current, Tag::temperature, Tag::amount,
+                                   Tag::luminosity, Tag::angle})
+        {
+            hash = fnv1a64(static_cast<std::uint64_t>(static_cast<std::int64_t>(exponent)), hash);
+        }
+        return hash;
+    }
+    else
+    {
+        static_assert(always_false_v<Tag>, "tag has no name — use STRONG_TYPES_REGISTER_TAG(Tag, \"name\")");
+        return 0;
+    }
+}
+
+template <typename Origin>
+[[nodiscard]] consteval std::uint64_t compute_origin_id() noexcept
+{
+    if constexpr (std::is_void_v<Origin>)
+    {
+        return 0;
+    }
+    else
+    {
+        constexpr auto name = origin_name<Origin>::value;
+        static_assert(!name.empty(), "origin has no name — add `static constexpr std::string_view name` or use "
+                                     "STRONG_TYPES_REGISTER_ORIGIN(Origin, \"name\")");
+        return fnv1a64(name, fnv1a64("origin:"));
+    }
+}
+
+template <typename Q>
+struct quantity_parts;
+
+template <typename T, typename Tag>
+struct quantity_parts<unit_t<T, Tag>>
+{
+    using tag = Tag;
+    using ratio = std::ratio<1>;
+    using origin = void;
+};
+
+template <typename T, typename Tag, typename R>
+struct quantity_parts<ScaledUnit<T, Tag, R>>
+{
+    using tag = Tag;
+    using ratio = R;
+    using origin = void;
+};
+
+template <typename T, typename Tag, typename Origin>
+struct quantity_parts<QuantityPoint<T, Tag, Origin>>
+{
+    using tag = Tag;
+    using ratio = std::ratio<1>;
+    using origin = Origin;
+};
+
+} // namespace detail
+
+// ---- IDs ----
+
+template <typename Tag>
+inline constexpr StableId tag_id_v = detail::compute_tag_id<Tag>();
+
+template <typename Ratio>
+inline constexpr StableId ratio_id_v =
+    detail::fnv1a64(static_cast<std::uint64_t>(Ratio::den),
+                    detail::fnv1a64(static_cast<std::uint64_t>(Ratio::num), detail::fnv1a64("ratio:")));
+
+template <typename Origin>
+inline constexpr StableId origin_id_v = detail::compute_origin_id<Origin>();
+
+/// One ID per (tag, ratio, origin); the value type is not part of it (Kilometers<float> == Kilometers<double>)
+template <typename Q>
+inline constexpr StableId quantity_id_v = []
+{
+    using Parts = detail::quantity_parts<std::remove_cvref_t<Q>>;
+    auto hash = detail::fnv1a64(tag_id_v<typename Parts::tag>, detail::fnv1a64("quantity:"));
+    hash = detail::fnv1a64(ratio_id_v<typename Parts::ratio>, hash);
+    return detail::fnv1a64(origin_id_v<typename Parts::origin>, hash);
+}();
+
+} // namespace strong_types
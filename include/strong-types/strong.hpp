@@ -48,7 +48,7 @@ struct Strong
     }
 
     template <typename U>
-        requires(!std::same_as<std::remove_cvref_t<U>, T> &&
+        requires(!std::same_as<std::remove_cvref_t<U>, T> && !std::same_as<std::remove_cvref_t<U>, Strong> &&
                  !(std::is_integral_v<T> && std::is_integral_v<std::remove_cvref_t<U>> &&
                    (sizeof(std::remove_cvref_t<U>) <= sizeof(T))))
     explicit Strong(U && /*unused*/) // NOLINT(cppcoreguidelines-missing-std-forward,google-explicit-constructor)
@@ -62,17 +62,43 @@ struct Strong
         requires std::default_initializable<T>
     = default;
 
-    [[nodiscard]] constexpr T get() const noexcept
+    [[nodiscard]] constexpr const T &get() const & noexcept
+    {
+        return value_;
+    }
+
+    /// Mutable access to the payload, for in-place updates of heavy value types. Arithmetic payloads
+    /// are changed only through the unit-checked operators, so they get read-only access.
+    [[nodiscard]] constexpr T &get() & noexcept
+        requires(!std::is_arithmetic_v<T>)
     {
         return value_;
     }
 
+    /// Moves the payload out of a temporary
+    [[nodiscard]] constexpr T get() && noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        return std::move(value_);
+    }
+
     [[nodiscard]] auto operator<=>(const Strong &) const = default;
 
 protected:
     T value_;
 };
 
+// ---- layout contract ----
+
+/// Q is bit-for-bit its payload: standard layout, trivially copyable, same size and alignment as
+/// value_type. Strong and ScaledUnit hold exactly one T, so they satisfy this for every arithmetic T;
+/// typed views (unit_span.hpp) rely on it to read raw T buffers as quantities.
+template <typename Q>
+concept ValueLayout = std::is_standard_layout_v<Q> && std::is_trivially_copyable_v<Q> &&
+                      sizeof(Q) == sizeof(typename Q::value_type) && alignof(Q) == alignof(typename Q::value_type);
+
+static_assert(ValueLayout<Strong<double, void>> && ValueLayout<Strong<float, void>> &&
+              ValueLayout<Strong<long long, void>>);
+
 // ---- scalar division result trait ----
 template <typename StrongType, Scalar ScalarType>
 struct scalar_division_result
@@ -272,25 +298,67 @@ template <typename T, typename TAG, Scalar S>
 }
 
 // ---- compound assignment ----
+//
+// Payloads that are not plain arithmetic (arrays, matrices) are updated in place through T's own
+// compound operator, so `a += b` never materializes a temporary T. Arithmetic payloads keep the
+// `lhs = lhs + rhs` form, which also applies the usual arithmetic conversions.
+
+template <typename T, typename U>
+concept InPlaceAddable = !std::is_arithmetic_v<T> && requires(T &lhs, const U &rhs) { lhs += rhs; };
+
+template <typename T, typename U>
+concept InPlaceSubtractable = !std::is_arithmetic_v<T> && requires(T &lhs, const U &rhs) { lhs -= rhs; };
+
+template <typename T, typename U>
+concept InPlaceMultipliable = !std::is_arithmetic_v<T> && requires(T &lhs, const U &rhs) { lhs *= rhs; };
+
+template <typename T, typename U>
+concept InPlaceDivisible = !std::is_arithmetic_v<T> && requires(T &lhs, const U &rhs) { lhs /= rhs; };
 
 template <typename T, typename TAG>
 constexpr Strong<T, TAG> &operator+=(Strong<T, TAG> &lhs, const Strong<T, TAG> &rhs)
 {
-    lhs = lhs + rhs;
+    if constexpr (InPlaceAddable<T, T>)
+    {
+        static_assert(std::is_same_v<typename sum_result<Strong<T, TAG>, Strong<T, TAG>>::type, Strong<T, TAG>>,
+                      "operator+= needs a sum of the same type");
+        lhs.get() += rhs.get();
+    }
+    else
+    {
+        lhs = lhs + rhs;
+    }
     return lhs;
 }
 
 template <typename T, typename TAG>
 constexpr Strong<T, TAG> &operator-=(Strong<T, TAG> &lhs, const Strong<T, TAG> &rhs)
 {
-    lhs = lhs - rhs;
+    if constexpr (InPlaceSubtractable<T, T>)
+    {
+        static_assert(
+            std::is_same_v<typename difference_result<Strong<T, TAG>, Strong<T, TAG>>::type, Strong<T, TAG>>,
+            "operator-= needs a difference of the same type");
+        lhs.get() -= rhs.get();
+    }
+    else
+    {
+        lhs = lhs - rhs;
+    }
     return lhs;
 }
 
 template <typename T, typename TAG, Scalar S>
 constexpr Strong<T, TAG> &operator*=(Strong<T, TAG> &lhs, S scalar)
 {
-    lhs = lhs * scalar;
+    if constexpr (InPlaceMultipliable<T, S>)
+    {
+        lhs.get() *= scalar;
+    }
+    else
+    {
+        lhs = lhs * scalar;
+    }
     return lhs;
 }
 
@@ -299,10 +367,84 @@ template <typename T, typename TAG, Scalar S>
     requires std::is_same_v<scalar_div_result_t<Strong<T, TAG>, S>, Strong<T, TAG>>
 constexpr Strong<T, TAG> &operator/=(Strong<T, TAG> &lhs, S scalar)
 {
-    lhs = lhs / scalar;
+    if constexpr (InPlaceDivisible<T, S>)
+    {
+        lhs.get() /= scalar;
+    }
+    else
+    {
+        lhs = lhs / scalar;
+    }
     return lhs;
 }
 
+// ---- rvalue operands: reuse the storage of a temporary instead of building a new T ----
+//
+// `a + b + c` on heavy payloads accumulates into the first temporary. These overloads bind only
+// to rvalues, so lvalue operands keep the copying (and const-correct) generic operators above.
+// Sums are taken as commutative; differences reuse only the left operand.
+
+template <typename T, typename TAG>
+    requires InPlaceAddable<T, T> && std::is_same_v<typename sum_result<Strong<T, TAG>, Strong<T, TAG>>::type,
+                                                     Strong<T, TAG>>
+[[nodiscard]] constexpr Strong<T, TAG> operator+(Strong<T, TAG> &&lhs, const Strong<T, TAG> &rhs)
+{
+    lhs.get() += rhs.get();
+    return std::move(lhs);
+}
+
+template <typename T, typename TAG>
+    requires InPlaceAddable<T, T> && std::is_same_v<typename sum_result<Strong<T, TAG>, Strong<T, TAG>>::type,
+                                                     Strong<T, TAG>>
+[[nodiscard]] constexpr Strong<T, TAG> operator+(const Strong<T, TAG> &lhs, Strong<T, TAG> &&rhs)
+{
+    rhs.get() += lhs.get();
+    return std::move(rhs);
+}
+
+template <typename T, typename TAG>
+    requires InPlaceAddable<T, T> && std::is_same_v<typename sum_result<Strong<T, TAG>, Strong<T, TAG>>::type,
+                                                     Strong<T, TAG>>
+[[nodiscard]] constexpr Strong<T, TAG> operator+(Strong<T, TAG> &&lhs, Strong<T, TAG> &&rhs)
+{
+    lhs.get() += rhs.get();
+    return std::move(lhs);
+}
+
+template <typename T, typename TAG>
+    requires InPlaceSubtractable<T, T> &&
+             std::is_same_v<typename difference_result<Strong<T, TAG>, Strong<T, TAG>>::type, Strong<T, TAG>>
+[[nodiscard]] constexpr Strong<T, TAG> operator-(Strong<T, TAG> &&lhs, const Strong<T, TAG> &rhs)
+{
+    lhs.get() -= rhs.get();
+    return std::move(lhs);
+}
+
+template <typename T, typename TAG, Scalar S>
+    requires NotStrong<S> && InPlaceMultipliable<T, S>
+[[nodiscard]] constexpr Strong<T, TAG> operator*(Strong<T, TAG> &&lhs, S scalar)
+{
+    lhs.get() *= scalar;
+    return std::move(lhs);
+}
+
+template <typename T, typename TAG, Scalar S>
+    requires NotStrong<S> && InPlaceMultipliable<T, S>
+[[nodiscard]] constexpr Strong<T, TAG> operator*(S scalar, Strong<T, TAG> &&rhs)
+{
+    rhs.get() *= scalar;
+    return std::move(rhs);
+}
+
+template <typename T, typename TAG, Scalar S>
+    requires NotStrong<S> && InPlaceDivisible<T, S> &&
+             std::is_same_v<scalar_div_result_t<Strong<T, TAG>, S>, Strong<T, TAG>>
+[[nodiscard]] constexpr Strong<T, TAG> operator/(Strong<T, TAG> &&lhs, S scalar)
+{
+    lhs.get() /= scalar;
+    return std::move(lhs);
+}
+
 // ---- unary ----
 
 template <typename T, typename TAG>
@@ -0,0 +1,286 @@
+#pragma once
+
+#include <algorithm>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace strong_types
+{
+
+// ---- Opaque IDs and the tables they index ----
+//
+// Strong<T, Tag> models a quantity, so it requires an arithmetic payload and gets the whole
+// operator set. An index or handle needs none of that: adding two joint IDs is a bug. StrongId is
+// the opaque variant. It compares and orders, but has no arithmetic and no implicit conversions.
+// StrongVector<Id, T> is a std::vector that only Id can index, so a lookup is one contiguous
+// access instead of a hash probe, and `joints[link_id]` does not compile.
+//
+//   struct JointTag;
+//   using JointId = StrongId<std::uint32_t, JointTag>;
+//   StrongVector<JointId, Joint> joints;
+//   const JointId elbow = joints.push_back(Joint{...});
+//   joints[elbow].angle = ...;
+
+template <std::unsigned_integral T, typename Tag>
+class StrongId
+{
+public:
+    using value_type = T;
+    using tag_type = Tag;
+
+    /// Default-constructed IDs are invalid()
+    constexpr StrongId() noexcept = default;
+
+    template <typename U>
+        requires std::same_as<U, T>
+    constexpr explicit StrongId(U value) noexcept : value_(value)
+    {
+    }
+
+    /// Widening from a narrower unsigned integer (e.g. uint16_t -> uint32_t)
+    template <std::unsigned_integral U>
+        requires(!std::same_as<U, T> && sizeof(U) < sizeof(T))
+    constexpr explicit StrongId(U value) noexcept : value_(value)
+    {
+    }
+
+    /// The ID for position `index` of a table; invalid() when the index does not fit below the sentinel
+    [[nodiscard]] static constexpr StrongId from_index(std::size_t index) noexcept
+    {
+        return index < std::size_t{std::numeric_limits<T>::max()} ? StrongId{static_cast<T>(index)} : invalid();
+    }
+
+    /// Tables indexed by this ID hold at most this many elements
+    [[nodiscard]] static constexpr std::size_t max_count() noexcept
+    {
+        return std::numeric_limits<T>::max();
+    }
+
+    /// The all-ones sentinel ("no joint"); never returned by StrongVector::push_back
+    [[nodiscard]] static constexpr StrongId invalid() noexcept
+    {
+        return StrongId{};
+    }
+
+    [[nodiscard]] constexpr T get() const noexcept
+    {
+        return value_;
+    }
+
+    [[nodiscard]] constexpr std::size_t index() const noexcept
+    {
+        return static_cast<std::size_t>(value_);
+    }
+
+    [[nodiscard]] constexpr bool is_valid() const noexcept
+    {
+        return value_ != std::numeric_limits<T>::max();
+    }
+
+    [[nodiscard]] constexpr bool operator==(const StrongId &) const noexcept = default;
+    [[nodiscard]] constexpr auto operator<=>(const StrongId &) const noexcept = default;
+
+private:
+    T value_ = std::numeric_limits<T>::max();
+};
+
+template <typename>
+struct is_strong_id : std::false_type
+{
+};
+
+template <typename T, typename Tag>
+struct is_strong_id<StrongId<T, Tag>> : std::true_type
+{
+};
+
+template <typename Id>
+concept StrongIdType = is_strong_id<std::remove_cvref_t<Id>>::value;
+
+static_assert(sizeof(StrongId<std::uint32_t, void>) == sizeof(std::uint32_t));
+static_assert(std::is_trivially_copyable_v<StrongId<std::uint32_t, void>>);
+
+/// Contiguous table of T indexed only by Id
+template <StrongIdType Id, typename T, typename Allocator = std::allocator<T>>
+class StrongVector
+{
+    using storage = std::vector<T, Allocator>;
+
+public:
+    using id_type = Id;
+    using value_type = T;
+    using size_type = typename storage::size_type;
+    using reference = typename storage::reference;
+    using const_reference = typename storage::const_reference;
+    using iterator = typename storage::iterator;
+    using const_iterator = typename storage::const_iterator;
+
+    constexpr StrongVector() = default;
+
+    /// The sizing constructors, resize() and the appends throw std::length_error above max_size()
+    constexpr explicit StrongVector(size_type count) : values_(checked_size(count))
+    {
+    }
+
+    constexpr StrongVector(size_type count, const T &value) : values_(checked_size(count), value)
+    {
+    }
+
+    constexpr StrongVector(std::initializer_list<T> values) : values_(values)
+    {
+        static_cast<void>(checked_size(values_.size()));
+    }
+
+    [[nodiscard]] constexpr size_type size() const noexcept
+    {
+        return values_.size();
+    }
+
+    [[nodiscard]] constexpr bool empty() const noexcept
+    {
+        return values_.empty();
+    }
+
+    /// Bounded by the ID type: StrongVector<StrongId<std::uint8_t, Tag>, T> holds at most 255 elements
+    [[nodiscard]] constexpr size_type max_size() const noexcept
+    {
+        return std::min<size_type>(values_.max_size(), Id::max_count());
+    }
+
+    constexpr void reserve(size_type count)
+    {
+        values_.reserve(count);
+    }
+
+    constexpr void resize(size_type count)
+    {
+        values_.resize(checked_size(count));
+    }
+
+    constexpr void clear() noexcept
+    {
+        values_.clear();
+    }
+
+    /// The ID the next push_back / emplace_back will return
+    [[nodiscard]] constexpr Id next_id() const noexcept
+    {
+        return Id::from_index(values_.size());
+    }
+
+    /// Appends and returns the new element's ID. Throws std::length_error once the ID type is
+    /// exhausted, instead of handing out invalid() or wrapped IDs that alias earlier elements.
+    constexpr Id push_back(const T &value)
+    {
+        static_cast<void>(checked_size(values_.size() + 1));
+        const Id id = next_id();
+        values_.push_back(value);
+        return id;
+    }
+
+    constexpr Id push_back(T &&value)
+    {
+        static_cast<void>(checked_size(values_.size() + 1));
+        const Id id = next_id();
+        values_.push_back(std::move(value));
+        return id;
+    }
+
+    template <typename... Args>
+    constexpr Id emplace_back(Args &&...args)
+    {
+        static_cast<void>(checked_size(values_.size() + 1));
+        const Id id = next_id();
+        values_.emplace_back(std::forward<Args>(args)...);
+        return id;
+    }
+
+    [[nodiscard]] constexpr bool contains(Id id) const noexcept
+    {
+        return id.is_valid() && id.index() < values_.size();
+    }
+
+    [[nodiscard]] constexpr reference operator[](Id id) noexcept
+    {
+        return values_[id.index()];
+    }
+
+    [[nodiscard]] constexpr const_reference operator[](Id id) const noexcept
+    {
+        return values_[id.index()];
+    }
+
+    /// nullptr when `id` is not in the table
+    [[nodiscard]] constexpr T *find(Id id) noexcept
+    {
+        return contains(id) ? std::addressof(values_[id.index()]) : nullptr;
+    }
+
+    [[nodiscard]] constexpr const T *find(Id id) const noexcept
+    {
+        return contains(id) ? std::addressof(values_[id.index()]) : nullptr;
+    }
+
+    /// Every valid ID in order: `for (auto id : joints.ids())`
+    [[nodiscard]] constexpr auto ids() const noexcept
+    {
+        return std::views::iota(size_type{0}, values_.size()) |
+               std::views::transform([](size_type index) { return Id::from_index(index); });
+    }
+
+    [[nodiscard]] constexpr iterator begin() noexcept
+    {
+        return values_.begin();
+    }
+
+    [[nodiscard]] constexpr iterator end() noexcept
+    {
+        return values_.end();
+    }
+
+    [[nodiscard]] constexpr const_iterator begin() const noexcept
+    {
+        return values_.begin();
+    }
+
+    [[nodiscard]] constexpr const_iterator end() const noexcept
+    {
+        return values_.end();
+    }
+
+    [[nodiscard]] constexpr T *data() noexcept
+    {
+        return values_.data();
+    }
+
+    [[nodiscard]] constexpr const T *data() const noexcept
+    {
+        return values_.data();
+    }
+
+    [[nodiscard]] constexpr bool operator==(const StrongVector &) const = default;
+
+private:
+    /// `count`, or std::length_error when Id cannot index that many elements (std::vector enforces its own limit)
+    static constexpr size_type checked_size(size_type count)
+    {
+        if (count > Id::max_count())
+        {
+            throw std::length_error("StrongVector: the ID type cannot index this many elements");
+        }
+        return count;
+    }
+
+    storage values_;
+};
+
+} // namespace strong_types
@@ -0,0 +1,318 @@
+#pragma once
+
+#include "soa_vector.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace strong_types
+{
+
+// ---- TimeIndex: Eytzinger-layout search over a sorted column ----
+//
+// std::lower_bound over millions of timestamps touches a new cache line on almost every probe,
+// and it cannot prefetch, because the next probe depends on the current compare. TimeIndex copies
+// the column's keys into Eytzinger (BFS) order: node k has children 2k and 2k + 1. The top levels
+// then share a few hot cache lines. All descendants of k that lie log2(B) levels down
+// (B = keys per cache line) sit in one 64-byte-aligned line, so each step prefetches that line.
+// The tree is padded to 2^L - 1 nodes with the largest value, so every search takes exactly L
+// branch-free steps. The batch queries advance 8 searches in lockstep, so their cache misses
+// overlap.
+//
+// Results are positions in the original sorted column, which the index keeps a span of. The
+// caller keeps that column alive and unchanged.
+//
+//   auto index = TimeIndex<SteadyTimePoint<std::int64_t>>::create(stamps);
+//   const std::size_t i = index->nearest(t);
+//   auto [before, after] = *index->bracket(t);   // stamps[before] <= t <= stamps[after]
+
+enum class IndexErrc
+{
+    empty,
+    not_sorted,
+    too_large,
+    size_mismatch,
+    out_of_range
+};
+
+template <typename Q>
+concept IndexableQuantity = requires(const Q &q) {
+    typename Q::value_type;
+    { q.get() } -> std::convertible_to<typename Q::value_type>;
+} && std::is_arithmetic_v<typename Q::value_type> && std::constructible_from<Q, typename Q::value_type>;
+
+namespace detail
+{
+
+inline void prefetch(const void *address) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address);
+#else
+    (void)address;
+#endif
+}
+
+} // namespace detail
+
+template <IndexableQuantity Q>
+class TimeIndex
+{
+    using T = typename Q::value_type;
+
+public:
+    using quantity_type = Q;
+    using size_type = std::size_t;
+    using bracket_type = std::pair<size_type, size_type>;
+
+    /// Searches advanced together by the batch queries
+    static constexpr size_type BATCH = 8;
+
+    /// Keys that share one cache line
+    static constexpr size_type LINE_KEYS = SOA_COLUMN_ALIGNMENT / sizeof(T);
+
+    /// Indexes `sorted` (ascending, duplicates allowed); `sorted` must outlive the index
+    [[nodiscard]] static std::expected<TimeIndex, IndexErrc> create(std::span<const Q> sorted)
+    {
+        if (sorted.size() >= std::numeric_limits<std::uint32_t>::max())
+        {
+            return std::unexpected(IndexErrc::too_large);
+        }
+        for (size_type i = 1; i < sorted.size(); ++i)
+        {
+            if (sorted[i].get() < sorted[i - 1].get())
+            {
+                return std::unexpected(IndexErrc::not_sorted);
+            }
+        }
+        return TimeIndex{sorted};
+    }
+
+    [[nodiscard]] size_type size() const noexcept
+    {
+        return source_.size();
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return source_.empty();
+    }
+
+    [[nodiscard]] std::span<const Q> source() const noexcept
+    {
+        return source_;
+    }
+
+    // ---- single queries ----
+
+    /// First position whose value is not less than `t`; size() when every value is less
+    [[nodiscard]] size_type lower_bound(const Q &t) const noexcept
+    {
+        const T key = t.get();
+        size_type node = 1;
+        for (size_type level = 0; level < levels_; ++level)
+        {
+            detail::prefetch(keys_.data() + node * LINE_KEYS);
+            node = 2 * node + static_cast<size_type>(keys_[node] < key);
+        }
+        return rank_of(node);
+    }
+
+    /// Position of the value closest to `t` (the earlier one on a tie); 0 when empty
+    [[nodiscard]] size_type nearest(const Q &t) const noexcept
+    {
+        return nearest_from(t, lower_bound(t));
+    }
+
+    /// Positions {before, after} with source()[before] <= t <= source()[after]. They are equal on an
+    /// exact match. Fails with out_of_range outside [front, back] and with empty on an empty column.
+    [[nodiscard]] std::expected<bracket_type, IndexErrc> bracket(const Q &t) const noexcept
+    {
+        if (empty())
+        {
+            return std::unexpected(IndexErrc::empty);
+        }
+        const bracket_type result = bracket_from(t, lower_bound(t));
+        if (result.first == size())
+        {
+            return std::unexpected(IndexErrc::out_of_range);
+        }
+        return result;
+    }
+
+    // ---- batch queries: out[i] answers queries[i] ----
+
+    std::expected<void, IndexErrc> lower_bound(std::span<const Q> queries, std::span<size_type> out) const noexcept
+    {
+        if (queries.size() != out.size())
+        {
+            return std::unexpected(IndexErrc::size_mismatch);
+        }
+        batch_lower_bound(queries, out);
+        return {};
+    }
+
+    std::expected<void, IndexErrc> nearest(std::span<const Q> queries, std::span<size_type> out) const noexcept
+    {
+        if (queries.size() != out.size())
+        {
+            return std::unexpected(IndexErrc::size_mismatch);
+        }
+        batch_lower_bound(queries, out);
+        for (size_type i = 0; i < queries.size(); ++i)
+        {
+            out[i] = nearest_from(queries[i], out[i]);
+        }
+        return {};
+    }
+
+    /// Queries outside [front, back] get {size(), size()}
+    std::expected<void, IndexErrc> bracket(std::span<const Q> queries, std::span<bracket_type> out) const noexcept
+    {
+        if (queries.size() != out.size())
+        {
+            return std::unexpected(IndexErrc::size_mismatch);
+        }
+        std::array<size_type, BATCH> bounds{};
+        for (size_type base = 0; base < queries.size(); base += BATCH)
+        {
+            const size_type count = std::min(BATCH, queries.size() - base);
+            batch_lower_bound(queries.subspan(base, count), std::span{bounds}.first(count));
+            for (size_type j = 0; j < count; ++j)
+            {
+                out[base + j] = bracket_from(queries[base + j], bounds[j]);
+            }
+        }
+        return {};
+    }
+
+private:
+    explicit TimeIndex(std::span<const Q> sorted)
+        : source_(sorted), levels_(static_cast<size_type>(std::bit_width(sorted.size())))
+    {
+        const size_type nodes = (size_type{1} << levels_) - 1;
+        keys_.assign(nodes + 1, std::numeric_limits<T>::max());
+        ranks_.assign(nodes + 1, static_cast<std::uint32_t>(sorted.size()));
+        size_type next = 0;
+        fill(1, nodes, next);
+    }
+
+    /// In-order walk: the i-th node visited holds the i-th smallest value
+    void fill(size_type node, size_type nodes, size_type &next)
+    {
+        if (node > nodes)
+        {
+            return;
+        }
+        fill(2 * node, nodes, next);
+        if (next < source_.size())
+        {
+            keys_[node] = source_[next].get();
+            ranks_[node] = static_cast<std::uint32_t>(next);
+        }
+        ++next;
+        fill(2 * node + 1, nodes, next);
+    }
+
+    /// `node` is the leaf-level position reached after levels_ steps. Dropping the trailing ones
+    /// (right turns) and then one more bit gives the last node where the search went left, which
+    /// is the first key not less than the query. If there is no such node, the result is 0.
+    [[nodiscard]] size_type rank_of(size_type node) const noexcept
+    {
+        node >>= static_cast<unsigned>(std::countr_one(node)) + 1U;
+        return node == 0 ? source_.size() : ranks_[node];
+    }
+
+    void batch_lower_bound(std::span<const Q> queries, std::span<size_type> out) const noexcept
+    {
+        std::array<T, BATCH> keys{};
+        std::array<size_type, BATCH> nodes{};
+        size_type base = 0;
+        for (; base + BATCH <= queries.size(); base += BATCH)
+        {
+            for (size_type j = 0; j < BATCH; ++j)
+            {
+                keys[j] = queries[base + j].get();
+                nodes[j] = 1;
+            }
+            for (size_type level = 0; level < levels_; ++level)
+            {
+                for (size_type j = 0; j < BATCH; ++j)
+                {
+                    detail::prefetch(keys_.data() + nodes[j] * LINE_KEYS);
+                    nodes[j] = 2 * nodes[j] + static_cast<size_type>(keys_[nodes[j]] < keys[j]);
+                }
+            }
+            for (size_type j = 0; j < BATCH; ++j)
+            {
+                out[base + j] = rank_of(nodes[j]);
+            }
+        }
+        for (; base < queries.size(); ++base)
+        {
+            out[base] = lower_bound(queries[base]);
+        }
+    }
+
+    /// hi - lo for lo <= hi. Integers subtract in the unsigned type, where the distance always fits
+    /// (-30000 to 30000 overflows int16_t but not uint16_t).
+    [[nodiscard]] static constexpr auto distance(T lo, T hi) noexcept
+    {
+        if constexpr (std::is_integral_v<T>)
+        {
+            using U = std::make_unsigned_t<T>;
+            return static_cast<U>(static_cast<U>(hi) - static_cast<U>(lo));
+        }
+        else
+        {
+            return hi - lo;
+        }
+    }
+
+    [[nodiscard]] size_type nearest_from(const Q &t, size_type bound) const noexcept
+    {
+        if (empty() || bound == 0)
+        {
+            return 0;
+        }
+        if (bound == size())
+        {
+            return size() - 1;
+        }
+        const T key = t.get();
+        const auto below = distance(source_[bound - 1].get(), key);
+        const auto above = distance(key, source_[bound].get());
+        return above < below ? bound : bound - 1;
+    }
+
+    [[nodiscard]] bracket_type bracket_from(const Q &t, size_type bound) const noexcept
+    {
+        const T key = t.get();
+        if (bound < size() && source_[bound].get() == key)
+        {
+            return {bound, bound};
+        }
+        if (bound == 0 || bound == size())
+        {
+            return {size(), size()};
+        }
+        return {bound - 1, bound};
+    }
+
+    std::span<const Q> source_;
+    size_type levels_ = 0;
+    std::vector<T, detail::ColumnAllocator<T>> keys_;
+    std::vector<std::uint32_t> ranks_;
+};
+
+} // namespace strong_types
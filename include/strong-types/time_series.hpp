@@ -0,0 +1,325 @@
+#pragma once
+
+#include "soa_vector.hpp"
+#include "unit_span.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <expected>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace strong_types
+{
+
+// ---- Chunked append-only time series ----
+//
+// A recorder that appends samples to a std::vector stalls whenever the vector grows, because every
+// old sample is copied, and during the copy the memory held is twice the live data. TimeSeries stores
+// samples in fixed-size chunks. Each chunk holds a 64-byte-aligned time column and value column.
+// Appending fills the last chunk and allocates a new one when it is full, so old samples never move.
+// reserve() allocates the chunks up front, after which append never allocates.
+//
+// Every chunk also keeps the min, max and sum of its values. Range aggregations use those summaries
+// for chunks that lie entirely inside the range, and scan only the two partial chunks at the ends.
+// Ranges are half-open, [from, to), and are found by binary search over the chunks' first times
+// followed by one search inside a chunk.
+//
+//   TimeSeries<SteadyTimePoint<std::int64_t>, unit_t<double, LengthTag>> depth;
+//   depth.append(t, unit_t<double, LengthTag>{3.0});   // SeriesErrc::out_of_order if t < back_time()
+//   auto [lo, hi] = *depth.minmax(from, to);
+//   depth.for_each_slice(from, to, [](auto times, auto values) { ... });   // QuantitySpans
+
+enum class SeriesErrc
+{
+    empty,
+    out_of_order
+};
+
+/// Default samples per chunk: 4096 samples are 32 KiB per 8-byte column
+inline constexpr std::size_t SERIES_CHUNK_SIZE = 4096;
+
+template <typename Time, typename Value, std::size_t ChunkSize = SERIES_CHUNK_SIZE>
+    requires(ValueLayout<Time> && ValueLayout<Value> && ChunkSize > 0)
+class TimeSeries
+{
+    using time_raw = typename Time::value_type;
+    using value_raw = typename Value::value_type;
+
+public:
+    using time_type = Time;
+    using value_type = Value;
+    using size_type = std::size_t;
+    using sample_type = std::pair<Time, Value>;
+    using time_span = QuantitySpan<Time, const time_raw>;
+    using value_span = QuantitySpan<Value, const value_raw>;
+
+    static constexpr size_type CHUNK_SIZE = ChunkSize;
+
+    TimeSeries() = default;
+
+    [[nodiscard]] size_type size() const noexcept
+    {
+        return size_;
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return size_ == 0;
+    }
+
+    /// Chunks holding samples; allocated spares from reserve() or clear() are not counted
+    [[nodiscard]] size_type chunk_count() const noexcept
+    {
+        return (size_ + ChunkSize - 1) / ChunkSize;
+    }
+
+    /// Allocates chunks for `count` samples, so that many appends never allocate
+    void reserve(size_type count)
+    {
+        const size_type chunks = (count + ChunkSize - 1) / ChunkSize;
+        chunks_.reserve(chunks);
+        while (chunks_.size() < chunks)
+        {
+            chunks_.push_back(std::make_unique_for_overwrite<Chunk>());
+        }
+    }
+
+    /// Drops every sample; keeps the chunks for reuse
+    void clear() noexcept
+    {
+        size_ = 0;
+    }
+
+    /// Fails with out_of_order when `time` is earlier than back_time(); equal times are allowed
+    std::expected<void, SeriesErrc> append(const Time &time, const Value &value)
+    {
+        const time_raw t = time.get();
+        const value_raw v = value.get();
+        if (size_ != 0 && t < raw_time(size_ - 1))
+        {
+            return std::unexpected(SeriesErrc::out_of_order);
+        }
+        const size_type slot = size_ % ChunkSize;
+        if (slot == 0 && size_ / ChunkSize == chunks_.size())
+        {
+            chunks_.push_back(std::make_unique_for_overwrite<Chunk>());
+        }
+        Chunk &chunk = *chunks_[size_ / ChunkSize];
+        chunk.times[slot] = t;
+        chunk.values[slot] = v;
+        if (slot == 0)
+        {
+            chunk.lo = v;
+            chunk.hi = v;
+            chunk.total = v;
+        }
+        else
+        {
+            chunk.lo = v < chunk.lo ? v : chunk.lo;
+            chunk.hi = chunk.hi < v ? v : chunk.hi;
+            chunk.total += v;
+        }
+        ++size_;
+        return {};
+    }
+
+    // ---- element access (unchecked: index < size()) ----
+
+    [[nodiscard]] Time time(size_type index) const noexcept
+    {
+        return std::bit_cast<Time>(raw_time(index));
+    }
+
+    [[nodiscard]] Value value(size_type index) const noexcept
+    {
+        return std::bit_cast<Value>(chunks_[index / ChunkSize]->values[index % ChunkSize]);
+    }
+
+    [[nodiscard]] sample_type operator[](size_type index) const noexcept
+    {
+        return {time(index), value(index)};
+    }
+
+    [[nodiscard]] std::expected<Time, SeriesErrc> front_time() const noexcept
+    {
+        if (empty())
+        {
+            return std::unexpected(SeriesErrc::empty);
+        }
+        return time(0);
+    }
+
+    [[nodiscard]] std::expected<Time, SeriesErrc> back_time() const noexcept
+    {
+        if (empty())
+        {
+            return std::unexpected(SeriesErrc::empty);
+        }
+        return time(size_ - 1);
+    }
+
+    /// Time and value columns of chunk `index` (index < chunk_count())
+    [[nodiscard]] std::pair<time_span, value_span> chunk(size_type index) const noexcept
+    {
+        const Chunk &c = *chunks_[index];
+        const size_type count = chunk_size(index);
+        return {time_span{c.times.data(), count}, value_span{c.values.data(), count}};
+    }
+
+    // ---- time-range queries over [from, to) ----
+
+    /// First position whose time is not earlier than `time`; size() when none is
+    [[nodiscard]] size_type lower_bound(const Time &time) const noexcept
+    {
+        const time_raw t = time.get();
+        const size_type chunks = chunk_count();
+        // First chunk whose first time is >= t; the answer lies in the chunk before it or at its start
+        size_type lo = 0;
+        size_type hi = chunks;
+        while (lo < hi)
+        {
+            const size_type mid = lo + (hi - lo) / 2;
+            if (chunks_[mid]->times[0] < t)
+            {
+                lo = mid + 1;
+            }
+            else
+            {
+                hi = mid;
+            }
+        }
+        if (lo == 0)
+        {
+            return 0;
+        }
+        const Chunk &c = *chunks_[lo - 1];
+        const time_raw *first = c.times.data();
+        const time_raw *last = first + chunk_size(lo - 1);
+        return (lo - 1) * ChunkSize + static_cast<size_type>(std::lower_bound(first, last, t) - first);
+    }
+
+    /// Positions [first, last) of the samples with from <= time < to
+    [[nodiscard]] std::pair<size_type, size_type> range(const Time &from, const Time &to) const noexcept
+    {
+        const size_type first = lower_bound(from);
+        return {first, std::max(first, lower_bound(to))};
+    }
+
+    [[nodiscard]] size_type count(const Time &from, const Time &to) const noexcept
+    {
+        const auto [first, last] = range(from, to);
+        return last - first;
+    }
+
+    /// Calls fn(time_span, value_span) once per chunk overlapping [from, to), in time order
+    template <typename Fn>
+    void for_each_slice(const Time &from, const Time &to, Fn &&fn) const
+    {
+        const auto [first, last] = range(from, to);
+        for (size_type begin = first; begin < last;)
+        {
+            const size_type index = begin / ChunkSize;
+            const size_type offset = begin % ChunkSize;
+            const size_type count = std::min(last - begin, ChunkSize - offset);
+            const auto [times, values] = chunk(index);
+            fn(times.subspan(offset, count), values.subspan(offset, count));
+            begin += count;
+        }
+    }
+
+    /// Sum of the values in [from, to); whole chunks contribute their stored sum
+    [[nodiscard]] Value sum(const Time &from, const Time &to) const noexcept
+    {
+        value_raw total{};
+        visit_summaries(
+            from, to, [&total](const Chunk &c) { total += c.total; },
+            [&total](value_span values) { total += strong_types::sum(values).get(); });
+        return Value{total};
+    }
+
+    [[nodiscard]] std::expected<Value, SeriesErrc> mean(const Time &from, const Time &to) const noexcept
+    {
+        const size_type samples = count(from, to);
+        if (samples == 0)
+        {
+            return std::unexpected(SeriesErrc::empty);
+        }
+        return Value{static_cast<value_raw>(sum(from, to).get() / static_cast<value_raw>(samples))};
+    }
+
+    /// {min, max} of the values in [from, to); whole chunks contribute their stored extremes
+    [[nodiscard]] std::expected<std::pair<Value, Value>, SeriesErrc> minmax(const Time &from,
+                                                                             const Time &to) const noexcept
+    {
+        bool seen = false;
+        value_raw lo{};
+        value_raw hi{};
+        const auto merge = [&](value_raw low, value_raw high) {
+            lo = !seen || low < lo ? low : lo;
+            hi = !seen || hi < high ? high : hi;
+            seen = true;
+        };
+        visit_summaries(
+            from, to, [&merge](const Chunk &c) { merge(c.lo, c.hi); },
+            [&merge](value_span values) {
+                const auto extremes = strong_types::minmax(values);
+                merge(extremes->first.get(), extremes->second.get());
+            });
+        if (!seen)
+        {
+            return std::unexpected(SeriesErrc::empty);
+        }
+        return std::pair{Value{lo}, Value{hi}};
+    }
+
+private:
+    struct Chunk
+    {
+        alignas(SOA_COLUMN_ALIGNMENT) std::array<time_raw, ChunkSize> times;
+        alignas(SOA_COLUMN_ALIGNMENT) std::array<value_raw, ChunkSize> values;
+        value_raw lo{};
+        value_raw hi{};
+        value_raw total{};
+    };
+
+    [[nodiscard]] time_raw raw_time(size_type index) const noexcept
+    {
+        return chunks_[index / ChunkSize]->times[index % ChunkSize];
+    }
+
+    [[nodiscard]] size_type chunk_size(size_type index) const noexcept
+    {
+        return std::min(ChunkSize, size_ - index * ChunkSize);
+    }
+
+    /// whole(chunk) for chunks entirely inside [from, to), partial(values) for the non-empty ends
+    template <typename Whole, typename Partial>
+    void visit_summaries(const Time &from, const Time &to, Whole whole, Partial partial) const
+    {
+        const auto [first, last] = range(from, to);
+        for (size_type begin = first; begin < last;)
+        {
+            const size_type index = begin / ChunkSize;
+            const size_type offset = begin % ChunkSize;
+            const size_type count = std::min(last - begin, ChunkSize - offset);
+            if (offset == 0 && count == chunk_size(index))
+            {
+                whole(*chunks_[index]);
+            }
+            else
+            {
+                partial(chunk(index).second.subspan(offset, count));
+            }
+            begin += count;
+        }
+    }
+
+    std::vector<std::unique_ptr<Chunk>> chunks_;
+    size_type size_ = 0;
+};
+
+} // namespace strong_types
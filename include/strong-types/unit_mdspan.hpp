@@ -0,0 +1,430 @@
+#pragma once
+
+#include "aligned_array.hpp"
+#include "unit_span.hpp"
+
+#include <bit>
+#include <cstddef>
+#include <expected>
+#include <type_traits>
+#include <utility>
+
+#if __has_include(<mdspan>)
+#include <mdspan>
+#endif
+
+#if defined(__cpp_lib_mdspan) && __cpp_lib_mdspan >= 202207L
+#define STRONG_TYPES_HAS_MDSPAN 1
+#else
+#define STRONG_TYPES_HAS_MDSPAN 0
+#endif
+
+#if STRONG_TYPES_HAS_MDSPAN
+
+namespace strong_types
+{
+
+// ---- std::mdspan over raw numeric storage with unit-typed elements ----
+//
+// quantity_accessor<Q, T> is an mdspan accessor policy. The element type is Q (const Q for a
+// read-only view), but the data handle stays a plain T*. Element access yields Q by value for
+// const T. Otherwise it yields QuantityRef (unit_span.hpp), a proxy that reads and writes the
+// slot with std::bit_cast (the ValueLayout contract). Two layouts join
+// std::layout_right / layout_left / layout_stride:
+//
+//   * layout_padded_rows<P>   row-major with the last extent rounded up to a multiple of P
+//                             elements; layout_aligned_rows<T> pads rows to AlignedArray's 64 bytes
+//   * layout_tiled<TR, TC>    rank 2, stored as TR x TC row-major tiles (blocked images, GEMM panels)
+//
+// The rank-2 algorithms below index through the mapping. For layout_right and layout_padded_rows
+// that is `i * stride + j`, so each inner loop is unit-stride and the compiler can vectorize it.
+// Needs a standard library with <mdspan> (STRONG_TYPES_HAS_MDSPAN); otherwise the header is empty.
+
+template <typename Q, typename T = typename Q::value_type>
+    requires std::is_same_v<std::remove_const_t<T>, typename Q::value_type>
+struct quantity_accessor
+{
+    static_assert(ValueLayout<Q>, "quantity_accessor needs a quantity with the layout of its value type");
+
+    using offset_policy = quantity_accessor;
+    using element_type = std::conditional_t<std::is_const_v<T>, const Q, Q>;
+    using quantity_type = Q;
+    using data_handle_type = T *;
+    using reference = std::conditional_t<std::is_const_v<T>, Q, QuantityRef<Q, T>>;
+
+    constexpr quantity_accessor() noexcept = default;
+
+    /// Mutable to read-only
+    template <typename U>
+        requires std::is_convertible_v<U (*)[], T (*)[]>
+    constexpr quantity_accessor(quantity_accessor<Q, U> /*unused*/) noexcept // NOLINT(google-explicit-constructor)
+    {
+    }
+
+    [[nodiscard]] constexpr reference access(data_handle_type data, std::size_t index) const noexcept
+    {
+        if constexpr (std::is_const_v<T>)
+        {
+            return std::bit_cast<Q>(data[index]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+        else
+        {
+            return QuantityRef<Q, T>{data[index]}; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+    }
+
+    [[nodiscard]] constexpr data_handle_type offset(data_handle_type data, std::size_t index) const noexcept
+    {
+        return data + index; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+};
+
+/// mdspan of Q over T storage (T may be const)
+template <typename Q, typename Extents, typename Layout = std::layout_right, typename T = typename Q::value_type>
+using quantity_mdspan =
+    std::mdspan<typename quantity_accessor<Q, T>::element_type, Extents, Layout, quantity_accessor<Q, T>>;
+
+template <typename T, typename Tag, typename Extents, typename Layout = std::layout_right>
+using unit_mdspan = quantity_mdspan<unit_t<std::remove_const_t<T>, Tag>, Extents, Layout, T>;
+
+template <typename T, typename Tag, typename Ratio, typename Extents, typename Layout = std::layout_right>
+using scaled_mdspan = quantity_mdspan<ScaledUnit<std::remove_const_t<T>, Tag, Ratio>, Extents, Layout, T>;
+
+// ---- layouts ----
+
+/// Row-major; consecutive rows start `row_stride()` elements apart, the last extent rounded up to Padding
+template <std::size_t Padding>
+struct layout_padded_rows
+{
+    static_assert(Padding > 0);
+
+    template <typename Extents>
+    class mapping
+    {
+    public:
+        using extents_type = Extents;
+        using index_type = typename Extents::index_type;
+        using size_type = typename Extents::size_type;
+        using rank_type = typename Extents::rank_type;
+        using layout_type = layout_padded_rows;
+
+        static_assert(Extents::rank() >= 1, "layout_padded_rows needs at least one extent");
+
+        constexpr mapping() noexcept = default;
+
+        constexpr explicit mapping(const extents_type &extents) noexcept : extents_(extents)
+        {
+        }
+
+        [[nodiscard]] constexpr const extents_type &extents() const noexcept
+        {
+            return extents_;
+        }
+
+        [[nodiscard]] constexpr index_type row_stride() const noexcept
+        {
+            constexpr auto pad = static_cast<index_type>(Padding);
+            return (extents_.extent(LAST) + pad - 1) / pad * pad;
+        }
+
+        [[nodiscard]] constexpr index_type stride(rank_type r) const noexcept
+        {
+            if (r == LAST)
+            {
+                return 1;
+            }
+            index_type result = row_stride();
+            for (rank_type k = r + 1; k < LAST; ++k)
+            {
+                result *= extents_.extent(k);
+            }
+            return result;
+        }
+
+        [[nodiscard]] constexpr index_type required_span_size() const noexcept
+        {
+            index_type size = 1;
+            for (rank_type r = 0; r < Extents::rank(); ++r)
+            {
+                if (extents_.extent(r) == 0)
+                {
+                    return 0;
+                }
+                size += (extents_.extent(r) - 1) * stride(r);
+            }
+            return size;
+        }
+
+        template <typename... Indices>
+            requires(sizeof...(Indices) == Extents::rank())
+        [[nodiscard]] constexpr index_type operator()(Indices... indices) const noexcept
+        {
+            return offset(std::make_index_sequence<Extents::rank()>{}, static_cast<index_type>(indices)...);
+        }
+
+        [[nodiscard]] static constexpr bool is_always_unique() noexcept
+        {
+            return true;
+        }
+
+        [[nodiscard]] static constexpr bool is_always_exhaustive() noexcept
+        {
+            return Padding == 1 || Extents::rank() == 1;
+        }
+
+        [[nodiscard]] static constexpr bool is_always_strided() noexcept
+        {
+            return true;
+        }
+
+        [[nodiscard]] static constexpr bool is_unique() noexcept
+        {
+            return true;
+        }
+
+        [[nodiscard]] constexpr bool is_exhaustive() const noexcept
+        {
+            return is_always_exhaustive() || row_stride() == extents_.extent(LAST);
+        }
+
+        [[nodiscard]] static constexpr bool is_strided() noexcept
+        {
+            return true;
+        }
+
+        [[nodiscard]] friend constexpr bool operator==(const mapping &lhs, const mapping &rhs) noexcept
+        {
+            return lhs.extents_ == rhs.extents_;
+        }
+
+    private:
+        static constexpr rank_type LAST = Extents::rank() - 1;
+
+        template <std::size_t... R, typename... I>
+        [[nodiscard]] constexpr index_type offset(std::index_sequence<R...> /*unused*/, I... indices) const noexcept
+        {
+            return static_cast<index_type>(((indices * stride(R)) + ... + 0));
+        }
+
+        extents_type extents_{};
+    };
+};
+
+/// Rows padded so each starts on an AlignedArray (64-byte) boundary when the data pointer does
+template <typename T>
+using layout_aligned_rows = layout_padded_rows<alignof(AlignedArray<std::remove_const_t<T>, 1>) / sizeof(T)>;
+
+/// Rank 2, stored as TileRows x TileCols row-major tiles, tiles in row-major order. Edge tiles are
+/// allocated whole, so required_span_size() rounds both extents up to the tile size.
+template <std::size_t TileRows, std::size_t TileCols>
+struct layout_tiled
+{
+    static_assert(TileRows > 0 && TileCols > 0);
+
+    template <typename Extents>
+    class mapping
+    {
+    public:
+        using extents_type = Extents;
+        using index_type = typename Extents::index_type;
+        using size_type = typename Extents::size_type;
+        using rank_type = typename Extents::rank_type;
+        using layout_type = layout_tiled;
+
+        static_assert(Extents::rank() == 2, "layout_tiled is rank 2");
+
+        constexpr mapping() noexcept = default;
+
+        constexpr explicit mapping(const extents_type &extents) noexcept : extents_(extents)
+        {
+        }
+
+        [[nodiscard]] constexpr const extents_type &extents() const noexcept
+        {
+            return extents_;
+        }
+
+        [[nodiscard]] constexpr index_type tiles_per_row() const noexcept
+        {
+            return (extents_.extent(1) + TC - 1) / TC;
+        }
+
+        [[nodiscard]] constexpr index_type required_span_size() const noexcept
+        {
+            return (extents_.extent(0) + TR - 1) / TR * tiles_per_row() * TR * TC;
+        }
+
+        template <typename I, typename J>
+        [[nodiscard]] constexpr index_type operator()(I row, J col) const noexcept
+        {
+            const auto i = static_cast<index_type>(row);
+            const auto j = static_cast<index_type>(col);
+            return ((i / TR) * tiles_per_row() + j / TC) * (TR * TC) + (i % TR) * TC + j % TC;
+        }
+
+        [[nodiscard]] static constexpr bool is_always_unique() noexcept
+        {
+            return true;
+        }
+
+        [[nodiscard]] static constexpr bool is_always_exhaustive() noexcept
+        {
+            return false;
+        }
+
+        [[nodiscard]] static constexpr bool is_always_strided() noexcept
+        {
+            return false;
+        }
+
+        [[nodiscard]] static constexpr bool is_unique() noexcept
+        {
+            return true;
+        }
+
+        [[nodiscard]] constexpr bool is_exhaustive() const noexcept
+        {
+            return extents_.extent(0) % TR == 0 && extents_.extent(1) % TC == 0;
+        }
+
+        /// Only a single column of tiles is strided: offset = i * TileCols + j
+        [[nodiscard]] constexpr bool is_strided() const noexcept
+        {
+            return extents_.extent(1) <= TC;
+        }
+
+        /// Precondition: is_strided()
+        [[nodiscard]] constexpr index_type stride(rank_type r) const noexcept
+        {
+            return r == 0 ? TC : 1;
+        }
+
+        [[nodiscard]] friend constexpr bool operator==(const mapping &lhs, const mapping &rhs) noexcept
+        {
+            return lhs.extents_ == rhs.extents_;
+        }
+
+    private:
+        static constexpr auto TR = static_cast<index_type>(TileRows);
+        static constexpr auto TC = static_cast<index_type>(TileCols);
+
+        extents_type extents_{};
+    };
+};
+
+// ---- rank-2 algorithms ----
+
+namespace detail
+{
+
+/// Raw slot (i, j); the quantity_accessor offset is plain pointer arithmetic, so this skips the proxy
+template <typename M>
+[[nodiscard]] constexpr auto &raw_at(const M &view, typename M::index_type row, typename M::index_type col) noexcept
+{
+    return view.data_handle()[view.mapping()(row, col)]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+/// Element (i, j) of a quantity_mdspan as its quantity type
+template <typename M, typename I>
+[[nodiscard]] constexpr auto quantity_at(const M &view, I row, I col) noexcept
+{
+    using Q = typename M::accessor_type::quantity_type;
+    using J = typename M::index_type;
+    return std::bit_cast<Q>(raw_at(view, static_cast<J>(row), static_cast<J>(col)));
+}
+
+template <typename M>
+[[nodiscard]] constexpr bool same_extents(const M & /*unused*/) noexcept
+{
+    return true;
+}
+
+template <typename M, typename N, typename... Rest>
+[[nodiscard]] constexpr bool same_extents(const M &first, const N &second, const Rest &...rest) noexcept
+{
+    return static_cast<std::size_t>(first.extent(0)) == static_cast<std::size_t>(second.extent(0)) &&
+           static_cast<std::size_t>(first.extent(1)) == static_cast<std::size_t>(second.extent(1)) &&
+           same_extents(second, rest...);
+}
+
+} // namespace detail
+
+template <typename E, typename Q, typename T, typename Extents, typename Layout>
+    requires(Extents::rank() == 2)
+[[nodiscard]] constexpr Q sum(std::mdspan<E, Extents, Layout, quantity_accessor<Q, T>> view) noexcept
+{
+    using I = typename Extents::index_type;
+    typename Q::value_type total{};
+    for (I i = 0; i < view.extent(0); ++i)
+    {
+        for (I j = 0; j < view.extent(1); ++j)
+        {
+            total += detail::raw_at(view, i, j);
+        }
+    }
+    return Q{total};
+}
+
+/// out[i] = sum of row i
+template <typename E, typename Q, typename T, typename Extents, typename Layout, typename U>
+    requires(Extents::rank() == 2 && !std::is_const_v<U>)
+constexpr std::expected<void, SpanErrc> row_sums(std::mdspan<E, Extents, Layout, quantity_accessor<Q, T>> view,
+                                                 QuantitySpan<Q, U> out) noexcept
+{
+    using I = typename Extents::index_type;
+    if (out.size() != static_cast<std::size_t>(view.extent(0)))
+    {
+        return std::unexpected(SpanErrc::size_mismatch);
+    }
+    for (I i = 0; i < view.extent(0); ++i)
+    {
+        typename Q::value_type total{};
+        for (I j = 0; j < view.extent(1); ++j)
+        {
+            total += detail::raw_at(view, i, j);
+        }
+        out.raw()[static_cast<std::size_t>(i)] = total;
+    }
+    return {};
+}
+
+template <typename E, typename Q, typename T, typename Extents, typename Layout>
+    requires(Extents::rank() == 2 && !std::is_const_v<T>)
+constexpr void fill(std::mdspan<E, Extents, Layout, quantity_accessor<Q, T>> view, const Q &value) noexcept
+{
+    using I = typename Extents::index_type;
+    for (I i = 0; i < view.extent(0); ++i)
+    {
+        for (I j = 0; j < view.extent(1); ++j)
+        {
+            detail::raw_at(view, i, j) = value.get();
+        }
+    }
+}
+
+/// dst[i, j] = fn(src[i, j]...) over typed quantities; all views must have the same extents.
+/// `fn` sees and returns quantities, so the tag algebra applies (e.g. a distance grid / a time grid)
+template <typename E, typename Q, typename T, typename Extents, typename Layout, typename Fn, typename... Src>
+    requires(Extents::rank() == 2 && !std::is_const_v<T>)
+constexpr std::expected<void, SpanErrc> elementwise(std::mdspan<E, Extents, Layout, quantity_accessor<Q, T>> dst,
+                                                    Fn fn, const Src &...src)
+{
+    using I = typename Extents::index_type;
+    if (!detail::same_extents(dst, src...))
+    {
+        return std::unexpected(SpanErrc::size_mismatch);
+    }
+    for (I i = 0; i < dst.extent(0); ++i)
+    {
+        for (I j = 0; j < dst.extent(1); ++j)
+        {
+            const Q result = fn(detail::quantity_at(src, i, j)...);
+            detail::raw_at(dst, i, j) = result.get();
+        }
+    }
+    return {};
+}
+
+} // namespace strong_types
+
+#endif // STRONG_TYPES_HAS_MDSPAN
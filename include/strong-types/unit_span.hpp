@@ -0,0 +1,404 @@
+#pragma once
+
+#include "si.hpp"
+#include "si_scaled.hpp"
+
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <expected>
+#include <iterator>
+#include <ratio>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace strong_types
+{
+
+// ---- Typed views over raw numeric buffers ----
+//
+// Driver and middleware buffers arrive as double* / float*. QuantitySpan<Q, T> types such a buffer
+// in place: element i reads as Q and writes back as T. No copy is made and no Q objects are
+// created in the buffer. The ValueLayout contract (strong.hpp) is checked when the view is
+// instantiated, and every access is a std::bit_cast between T and Q, so the view never has to
+// reinterpret a T* as a Q*.
+//
+//   unit_span<const double, LengthTag> in{raw, n};        // read-only metres
+//   scaled_span<float, TimeTag, std::milli> out{dst, n};  // writable milliseconds
+//   auto mm = view_as<Millimeters<double>>(std::span{buf, n});
+
+enum class SpanErrc
+{
+    empty,
+    size_mismatch
+};
+
+namespace detail
+{
+
+template <typename Q>
+struct span_ratio
+{
+    using type = std::ratio<1>;
+};
+
+template <typename T, typename Tag, typename R>
+struct span_ratio<ScaledUnit<T, Tag, R>>
+{
+    using type = R;
+};
+
+/// x * F::num / F::den. Integers split x into whole multiples of den and a remainder, so x * num
+/// cannot overflow unless the result itself does; the quotient truncates toward zero like a cast.
+template <typename F, typename C>
+[[nodiscard]] constexpr C apply_ratio(C x) noexcept
+{
+    constexpr auto num = static_cast<C>(F::num);
+    constexpr auto den = static_cast<C>(F::den);
+    if constexpr (std::is_floating_point_v<C>)
+    {
+        return x * num / den;
+    }
+    else if constexpr (F::den == 1)
+    {
+        return x * num;
+    }
+    else
+    {
+        return x / den * num + x % den * num / den;
+    }
+}
+
+} // namespace detail
+
+/// Proxy reference to a T slot viewed as Q (mdspan elements, soa_vector fields)
+template <typename Q, typename T>
+class QuantityRef
+{
+public:
+    constexpr explicit QuantityRef(T &slot) noexcept : slot_(&slot)
+    {
+    }
+
+    constexpr QuantityRef(const QuantityRef &) noexcept = default;
+
+    /// Assigns the referenced value, not the reference
+    constexpr QuantityRef &operator=(const QuantityRef &other) noexcept
+    {
+        *slot_ = *other.slot_;
+        return *this;
+    }
+
+    constexpr QuantityRef &operator=(const Q &value) noexcept
+    {
+        *slot_ = std::bit_cast<T>(value);
+        return *this;
+    }
+
+    constexpr QuantityRef &operator+=(const Q &value) noexcept
+    {
+        *slot_ += value.get();
+        return *this;
+    }
+
+    constexpr QuantityRef &operator-=(const Q &value) noexcept
+    {
+        *slot_ -= value.get();
+        return *this;
+    }
+
+    constexpr operator Q() const noexcept // NOLINT(google-explicit-constructor)
+    {
+        return std::bit_cast<Q>(*slot_);
+    }
+
+    [[nodiscard]] constexpr Q get() const noexcept
+    {
+        return std::bit_cast<Q>(*slot_);
+    }
+
+    constexpr ~QuantityRef() = default;
+
+private:
+    T *slot_;
+};
+
+/// View of `std::span<T>` as quantities `Q`; T may be const-qualified for a read-only view
+template <typename Q, typename T = typename Q::value_type>
+    requires std::is_same_v<std::remove_const_t<T>, typename Q::value_type>
+class QuantitySpan
+{
+    static_assert(ValueLayout<Q>, "QuantitySpan needs a quantity with the layout of its value type");
+
+public:
+    using quantity_type = Q;
+    using element_type = T;
+    using value_type = typename Q::value_type;
+    using tag_type = typename Q::tag_type;
+    using ratio_type = typename detail::span_ratio<Q>::type;
+    using size_type = std::size_t;
+
+    class iterator
+    {
+    public:
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::input_iterator_tag; // elements are returned by value
+        using value_type = Q;
+        using difference_type = std::ptrdiff_t;
+        using reference = Q;
+
+        constexpr iterator() noexcept = default;
+        constexpr explicit iterator(T *ptr) noexcept : ptr_(ptr)
+        {
+        }
+
+        [[nodiscard]] constexpr Q operator*() const noexcept
+        {
+            return std::bit_cast<Q>(*ptr_);
+        }
+
+        [[nodiscard]] constexpr Q operator[](difference_type offset) const noexcept
+        {
+            return std::bit_cast<Q>(ptr_[offset]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+
+        constexpr iterator &operator++() noexcept
+        {
+            ++ptr_; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            return *this;
+        }
+
+        constexpr iterator operator++(int) noexcept
+        {
+            auto prev = *this;
+            ++*this;
+            return prev;
+        }
+
+        constexpr iterator &operator--() noexcept
+        {
+            --ptr_; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            return *this;
+        }
+
+        constexpr iterator operator--(int) noexcept
+        {
+            auto prev = *this;
+            --*this;
+            return prev;
+        }
+
+        constexpr iterator &operator+=(difference_type offset) noexcept
+        {
+            ptr_ += offset; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            return *this;
+        }
+
+        constexpr iterator &operator-=(difference_type offset) noexcept
+        {
+            ptr_ -= offset; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            return *this;
+        }
+
+        [[nodiscard]] friend constexpr iterator operator+(iterator it, difference_type offset) noexcept
+        {
+            return it += offset;
+        }
+
+        [[nodiscard]] friend constexpr iterator operator+(difference_type offset, iterator it) noexcept
+        {
+            return it += offset;
+        }
+
+        [[nodiscard]] friend constexpr iterator operator-(iterator it, difference_type offset) noexcept
+        {
+            return it -= offset;
+        }
+
+        [[nodiscard]] friend constexpr difference_type operator-(const iterator &lhs, const iterator &rhs) noexcept
+        {
+            return lhs.ptr_ - rhs.ptr_;
+        }
+
+        [[nodiscard]] constexpr bool operator==(const iterator &) const noexcept = default;
+        [[nodiscard]] constexpr auto operator<=>(const iterator &) const noexcept = default;
+
+    private:
+        T *ptr_{};
+    };
+
+    constexpr QuantitySpan() noexcept = default;
+
+    constexpr explicit QuantitySpan(std::span<T> raw) noexcept : raw_(raw)
+    {
+    }
+
+    constexpr QuantitySpan(T *data, size_type size) noexcept : raw_(data, size)
+    {
+    }
+
+    /// A mutable view converts to a read-only one
+    template <typename U>
+        requires std::is_const_v<T> && std::is_same_v<U, value_type>
+    constexpr QuantitySpan(QuantitySpan<Q, U> other) noexcept // NOLINT(google-explicit-constructor)
+        : raw_(other.raw())
+    {
+    }
+
+    [[nodiscard]] constexpr size_type size() const noexcept
+    {
+        return raw_.size();
+    }
+
+    [[nodiscard]] constexpr bool empty() const noexcept
+    {
+        return raw_.empty();
+    }
+
+    /// The underlying buffer, for handing back to untyped code
+    [[nodiscard]] constexpr std::span<T> raw() const noexcept
+    {
+        return raw_;
+    }
+
+    [[nodiscard]] constexpr Q operator[](size_type index) const noexcept
+    {
+        return std::bit_cast<Q>(raw_[index]);
+    }
+
+    constexpr void set(size_type index, const Q &value) const noexcept
+        requires(!std::is_const_v<T>)
+    {
+        raw_[index] = std::bit_cast<value_type>(value);
+    }
+
+    [[nodiscard]] constexpr iterator begin() const noexcept
+    {
+        return iterator{raw_.data()};
+    }
+
+    [[nodiscard]] constexpr iterator end() const noexcept
+    {
+        return iterator{raw_.data() + raw_.size()}; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+    [[nodiscard]] constexpr QuantitySpan first(size_type count) const noexcept
+    {
+        return QuantitySpan{raw_.first(count)};
+    }
+
+    [[nodiscard]] constexpr QuantitySpan last(size_type count) const noexcept
+    {
+        return QuantitySpan{raw_.last(count)};
+    }
+
+    [[nodiscard]] constexpr QuantitySpan subspan(size_type offset, size_type count = std::dynamic_extent) const noexcept
+    {
+        return QuantitySpan{raw_.subspan(offset, count)};
+    }
+
+private:
+    std::span<T> raw_;
+};
+
+template <typename T, typename Tag>
+using unit_span = QuantitySpan<unit_t<std::remove_const_t<T>, Tag>, T>;
+
+template <typename T, typename Tag, typename Ratio>
+using scaled_span = QuantitySpan<ScaledUnit<std::remove_const_t<T>, Tag, Ratio>, T>;
+
+/// `view_as<Millimeters<double>>(std::span<const double>{raw, n})`
+template <typename Q, typename T, std::size_t Extent>
+[[nodiscard]] constexpr QuantitySpan<Q, T> view_as(std::span<T, Extent> raw) noexcept
+{
+    return QuantitySpan<Q, T>{raw};
+}
+
+// ---- bulk algorithms: plain loops over the raw buffer ----
+
+template <typename Q, typename T>
+[[nodiscard]] constexpr Q sum(QuantitySpan<Q, T> view) noexcept
+{
+    typename Q::value_type total{};
+    for (const auto value : view.raw())
+    {
+        total += value;
+    }
+    return Q{total};
+}
+
+template <typename Q, typename T>
+[[nodiscard]] constexpr std::expected<Q, SpanErrc> mean(QuantitySpan<Q, T> view) noexcept
+{
+    using V = typename Q::value_type;
+    if (view.empty())
+    {
+        return std::unexpected(SpanErrc::empty);
+    }
+    return Q{static_cast<V>(sum(view).get() / static_cast<V>(view.size()))};
+}
+
+template <typename Q, typename T>
+[[nodiscard]] constexpr std::expected<std::pair<Q, Q>, SpanErrc> minmax(QuantitySpan<Q, T> view) noexcept
+{
+    if (view.empty())
+    {
+        return std::unexpected(SpanErrc::empty);
+    }
+    const auto raw = view.raw();
+    auto lo = raw[0];
+    auto hi = raw[0];
+    for (const auto value : raw)
+    {
+        lo = value < lo ? value : lo;
+        hi = hi < value ? value : hi;
+    }
+    return std::pair{Q{lo}, Q{hi}};
+}
+
+template <typename Q, typename T>
+    requires(!std::is_const_v<T>)
+constexpr void fill(QuantitySpan<Q, T> view, const Q &value) noexcept
+{
+    for (auto &slot : view.raw())
+    {
+        slot = value.get();
+    }
+}
+
+/// Rescale every element of `src` into `dst` (same tag; scale and value type may differ). Floating
+/// targets multiply by one precomputed factor so the loop vectorizes. Integer targets apply num / den
+/// in the common type of source and target, so a fractional source is truncated only once, at the end.
+template <typename SrcQ, typename SrcT, typename DstQ, typename DstT>
+    requires std::is_same_v<typename SrcQ::tag_type, typename DstQ::tag_type> && (!std::is_const_v<DstT>)
+constexpr std::expected<void, SpanErrc> convert(QuantitySpan<SrcQ, SrcT> src, QuantitySpan<DstQ, DstT> dst) noexcept
+{
+    using V = typename DstQ::value_type;
+    using F = std::ratio_divide<typename detail::span_ratio<SrcQ>::type, typename detail::span_ratio<DstQ>::type>;
+    if (src.size() != dst.size())
+    {
+        return std::unexpected(SpanErrc::size_mismatch);
+    }
+    const auto in = src.raw();
+    const auto out = dst.raw();
+    if constexpr (std::is_floating_point_v<V>)
+    {
+        constexpr V factor = static_cast<V>(F::num) / static_cast<V>(F::den);
+        for (std::size_t i = 0; i < in.size(); ++i)
+        {
+            out[i] = static_cast<V>(in[i]) * factor;
+        }
+    }
+    else
+    {
+        using C = std::common_type_t<typename SrcQ::value_type, V>;
+        for (std::size_t i = 0; i < in.size(); ++i)
+        {
+            out[i] = static_cast<V>(detail::apply_ratio<F>(static_cast<C>(in[i])));
+        }
+    }
+    return {};
+}
+
+} // namespace strong_types
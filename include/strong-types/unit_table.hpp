@@ -0,0 +1,289 @@
+#pragma once
+
+#include "si.hpp"
+#include "si_scaled.hpp"
+#include "unit_suffix.hpp"
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <limits>
+#include <ratio>
+#include <span>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+namespace strong_types
+{
+
+// ---- Runtime unit table: suffix string -> dense ID -> conversion factor ----
+//
+// Generated at compile time from tag_suffix / scaled_suffix over every SI tag and scaled alias.
+// Decoding a unit name from a config file or wire message is one perfect-hash probe and one
+// string compare. Converting between two IDs of the same tag uses one factor derived from the
+// stored ratios, so the caller needs no template dispatch on the source unit.
+
+enum class UnitErrc
+{
+    unknown_unit,
+    dimension_mismatch,
+    size_mismatch
+};
+
+/// Dense index into unit_table()
+using UnitId = std::uint8_t;
+
+struct UnitInfo
+{
+    std::string_view suffix;
+    UnitId base;         ///< ID of the ratio-1 unit with the same tag; equal bases are convertible
+    std::intmax_t num;   ///< ratio to the base unit: value × num / den = value in the base unit
+    std::intmax_t den;
+};
+
+namespace detail
+{
+
+template <typename Tag, typename Ratio>
+struct UnitKey
+{
+};
+
+/// Every unit with a suffix: base tags first, then the scaled aliases
+using RegisteredUnits = std::tuple<
+    UnitKey<LengthTag, std::ratio<1>>, UnitKey<MassTag, std::ratio<1>>, UnitKey<TimeTag, std::ratio<1>>,
+    UnitKey<AreaTag, std::ratio<1>>, UnitKey<SpeedTag, std::ratio<1>>, UnitKey<AccelerationTag, std::ratio<1>>,
+    UnitKey<ForceTag, std::ratio<1>>, UnitKey<EnergyTag, std::ratio<1>>, UnitKey<HertzTag, std::ratio<1>>,
+    UnitKey<CelsiusTag, std::ratio<1>>, UnitKey<VoltTag, std::ratio<1>>, UnitKey<RadianTag, std::ratio<1>>,
+    UnitKey<SteradianTag, std::ratio<1>>, UnitKey<PowerTag, std::ratio<1>>, UnitKey<PressureTag, std::ratio<1>>,
+    UnitKey<AngularVelocityTag, std::ratio<1>>, UnitKey<VolumeTag, std::ratio<1>>,
+    UnitKey<DensityTag, std::ratio<1>>, UnitKey<TorqueTag, std::ratio<1>>,
+    UnitKey<LengthTag, Micrometers<double>::ratio_type>, UnitKey<LengthTag, Millimeters<double>::ratio_type>,
+    UnitKey<LengthTag, Centimeters<double>::ratio_type>, UnitKey<LengthTag, Kilometers<double>::ratio_type>,
+    UnitKey<TimeTag, Nanoseconds<double>::ratio_type>, UnitKey<TimeTag, Microseconds<double>::ratio_type>,
+    UnitKey<TimeTag, Milliseconds<double>::ratio_type>, UnitKey<TimeTag, Minutes<double>::ratio_type>,
+    UnitKey<TimeTag, Hours<double>::ratio_type>, UnitKey<TimeTag, Days<double>::ratio_type>,
+    UnitKey<TimeTag, Weeks<double>::ratio_type>, UnitKey<MassTag, Milligrams<double>::ratio_type>,
+    UnitKey<MassTag, Grams<double>::ratio_type>, UnitKey<MassTag, Tons<double>::ratio_type>,
+    UnitKey<SpeedTag, KilometersPerHour<double>::ratio_type>>;
+
+/// FNV-1a with a seed, finished with an xor-shift so the low bits used for the slot are well mixed
+[[nodiscard]] constexpr std::uint32_t suffix_hash(std::string_view suffix, std::uint32_t seed) noexcept
+{
+    std::uint32_t hash = 2166136261U ^ seed;
+    for (const char c : suffix)
+    {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 16777619U;
+    }
+    return hash ^ (hash >> 16U);
+}
+
+template <typename Units>
+struct UnitTable;
+
+template <typename... Tags, typename... Ratios>
+struct UnitTable<std::tuple<UnitKey<Tags, Ratios>...>>
+{
+    static constexpr std::size_t SIZE = sizeof...(Tags);
+    static constexpr std::size_t SLOTS = std::bit_ceil(SIZE * 4);
+    static constexpr UnitId EMPTY = std::numeric_limits<UnitId>::max();
+    static_assert(SIZE < EMPTY, "UnitId is too narrow for the registered units");
+
+    template <typename Tag, typename Ratio>
+    [[nodiscard]] static constexpr std::size_t index_of() noexcept
+    {
+        constexpr std::array<bool, SIZE> match{(std::is_same_v<Tags, Tag> && std::ratio_equal_v<Ratios, Ratio>)...};
+        for (std::size_t i = 0; i < SIZE; ++i)
+        {
+            if (match[i])
+            {
+                return i;
+            }
+        }
+        return SIZE;
+    }
+
+    static constexpr std::array<UnitInfo, SIZE> INFO{
+        UnitInfo{scaled_suffix<Tags, Ratios>::value, static_cast<UnitId>(index_of<Tags, std::ratio<1>>()), Ratios::num,
+                 Ratios::den}...};
+
+    /// First seed for which every suffix lands in its own slot
+    [[nodiscard]] static constexpr std::uint32_t find_seed() noexcept
+    {
+        for (std::uint32_t seed = 0;; ++seed)
+        {
+            std::array<bool, SLOTS> used{};
+            bool collision = false;
+            for (const auto &info : INFO)
+            {
+                const auto slot = suffix_hash(info.suffix, seed) & (SLOTS - 1);
+                collision = collision || used[slot];
+                used[slot] = true;
+            }
+            if (!collision)
+            {
+                return seed;
+            }
+        }
+    }
+
+    static constexpr std::uint32_t SEED = find_seed();
+
+    [[nodiscard]] static constexpr std::array<UnitId, SLOTS> build_slots() noexcept
+    {
+        std::array<UnitId, SLOTS> slots{};
+        slots.fill(EMPTY);
+        for (std::size_t i = 0; i < SIZE; ++i)
+        {
+            slots[suffix_hash(INFO[i].suffix, SEED) & (SLOTS - 1)] = static_cast<UnitId>(i);
+        }
+        return slots;
+    }
+
+    static constexpr std::array<UnitId, SLOTS> SLOT_IDS = build_slots();
+};
+
+using DefaultUnitTable = UnitTable<RegisteredUnits>;
+
+[[nodiscard]] constexpr bool suffixes_unique() noexcept
+{
+    const auto &info = DefaultUnitTable::INFO;
+    for (std::size_t i = 0; i < info.size(); ++i)
+    {
+        if (info[i].suffix.empty())
+        {
+            return false;
+        }
+        for (std::size_t j = i + 1; j < info.size(); ++j)
+        {
+            if (info[i].suffix == info[j].suffix)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static_assert(suffixes_unique(), "every registered unit needs a distinct, non-empty suffix");
+
+template <typename U>
+struct unit_key_of;
+
+template <typename T, typename Tag>
+struct unit_key_of<unit_t<T, Tag>>
+{
+    using tag = Tag;
+    using ratio = std::ratio<1>;
+};
+
+template <typename T, typename Tag, typename R>
+struct unit_key_of<ScaledUnit<T, Tag, R>>
+{
+    using tag = Tag;
+    using ratio = R;
+};
+
+} // namespace detail
+
+// ---- lookup ----
+
+[[nodiscard]] constexpr std::span<const UnitInfo> unit_table() noexcept
+{
+    return detail::DefaultUnitTable::INFO;
+}
+
+/// Compile-time ID of a unit_t or ScaledUnit type
+template <typename U>
+inline constexpr UnitId unit_id_v = []
+{
+    using Key = detail::unit_key_of<std::remove_cvref_t<U>>;
+    constexpr auto index = detail::DefaultUnitTable::index_of<typename Key::tag, typename Key::ratio>();
+    static_assert(index < detail::DefaultUnitTable::SIZE, "unit has no registered suffix");
+    return static_cast<UnitId>(index);
+}();
+
+/// Suffix string ("mm", "km/h", "us") -> ID
+[[nodiscard]] constexpr std::expected<UnitId, UnitErrc> find_unit(std::string_view suffix) noexcept
+{
+    using Table = detail::DefaultUnitTable;
+    const auto id = Table::SLOT_IDS[detail::suffix_hash(suffix, Table::SEED) & (Table::SLOTS - 1)];
+    if (id == Table::EMPTY || Table::INFO[id].suffix != suffix)
+    {
+        return std::unexpected(UnitErrc::unknown_unit);
+    }
+    return id;
+}
+
+// ---- conversion ----
+
+/// Multiplier taking a value in `from` to a value in `to`, rounded once from the exact ratios
+[[nodiscard]] constexpr std::expected<double, UnitErrc> conversion_factor(UnitId from, UnitId to) noexcept
+{
+    const auto table = unit_table();
+    if (from >= table.size() || to >= table.size())
+    {
+        return std::unexpected(UnitErrc::unknown_unit);
+    }
+    const auto &src = table[from];
+    const auto &dst = table[to];
+    if (src.base != dst.base)
+    {
+        return std::unexpected(UnitErrc::dimension_mismatch);
+    }
+    return (static_cast<double>(src.num) * static_cast<double>(dst.den)) /
+           (static_cast<double>(src.den) * static_cast<double>(dst.num));
+}
+
+[[nodiscard]] constexpr std::expected<double, UnitErrc> convert(double value, UnitId from, UnitId to) noexcept
+{
+    const auto factor = conversion_factor(from, to);
+    if (!factor)
+    {
+        return std::unexpected(factor.error());
+    }
+    return value * *factor;
+}
+
+/// Bulk conversion with a runtime source unit: one factor lookup, then a branch-free multiply loop
+/// the compiler vectorizes
+constexpr std::expected<void, UnitErrc> convert(std::span<const double> src, UnitId from, std::span<double> dst,
+                                                UnitId to) noexcept
+{
+    if (src.size() != dst.size())
+    {
+        return std::unexpected(UnitErrc::size_mismatch);
+    }
+    const auto factor = conversion_factor(from, to);
+    if (!factor)
+    {
+        return std::unexpected(factor.error());
+    }
+    const double f = *factor;
+    const double *in = src.data();
+    double *out = dst.data();
+    for (std::size_t i = 0; i < src.size(); ++i)
+    {
+        out[i] = in[i] * f; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+    return {};
+}
+
+/// Decode a value tagged with a runtime unit ID into a typed quantity
+template <typename Target>
+    requires std::is_floating_point_v<typename Target::value_type>
+[[nodiscard]] constexpr std::expected<Target, UnitErrc> quantity_from(double value, UnitId from) noexcept
+{
+    const auto converted = convert(value, from, unit_id_v<Target>);
+    if (!converted)
+    {
+        return std::unexpected(converted.error());
+    }
+    return Target{static_cast<typename Target::value_type>(*converted)};
+}
+
+} // namespace strong_types
@@ -0,0 +1,7 @@
+// fmt::formatter instantiations for strong-types::compiled, built only when {fmt} is found
+// (consumers see the `extern template` declarations through STRONG_TYPES_EXTERN_FORMATTERS=1).
+
+#include "strong-types/extern_templates.hpp"
+#include "strong-types/fmt.hpp"
+
+STRONG_TYPES_INSTANTIATE_FORMATTERS(template)
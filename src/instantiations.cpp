@@ -0,0 +1,9 @@
+// Explicit instantiation definitions for strong-types::compiled. Consumers of the target see the
+// matching `extern template` declarations (STRONG_TYPES_EXTERN_TEMPLATES=1) and link against these.
+
+#include "strong-types/extern_templates.hpp"
+#include "strong-types/si.hpp"
+#include "strong-types/si_scaled.hpp"
+
+STRONG_TYPES_INSTANTIATE_SI_UNITS(template)
+STRONG_TYPES_INSTANTIATE_SCALED_UNITS(template)
@@ -0,0 +1,441 @@
+// strong_types — C++20 named module interface for the header-only library.
+//
+//   import strong_types;
+//
+// Re-exports the public API of every header, including the si_literals / si_scaled_literals
+// namespaces. The headers are parsed once, into the BMI, instead of once per translation unit.
+// Macros cannot cross a module boundary: STRONG_TYPES_PROFILE_SCOPE, STRONG_TYPES_REGISTER_* and the
+// STRONG_TYPES_HAS_* feature flags still need the corresponding #include. Define STRONG_TYPES_MODULE_FMT=1 (the
+// CMake target does so when {fmt} is found) to also export the fmt formatters. strong_types::profiling is exported
+// as the no-op API unless the module is built with STRONG_TYPES_PROFILING=1, which also needs STRONG_TYPES_MODULE_FMT.
+
+module;
+
+#include "strong-types/aligned_array.hpp"
+#include "strong-types/any_quantity.hpp"
+#include "strong-types/clock.hpp"
+#include "strong-types/column_file.hpp"
+#include "strong-types/dimension.hpp"
+#include "strong-types/event_loop.hpp"
+#include "strong-types/flat_hash_map.hpp"
+#include "strong-types/hash.hpp"
+#include "strong-types/latency_histogram.hpp"
+#include "strong-types/periodic_loop.hpp"
+#include "strong-types/profiling.hpp"
+#include "strong-types/quantity_expr.hpp"
+#include "strong-types/quantity_point.hpp"
+#include "strong-types/radix_sort.hpp"
+#include "strong-types/rate_limiter.hpp"
+#include "strong-types/safe_math.hpp"
+#include "strong-types/si.hpp"
+#include "strong-types/si_chrono.hpp"
+#include "strong-types/si_literals.hpp"
+#include "strong-types/si_scaled.hpp"
+#include "strong-types/si_scaled_literals.hpp"
+#include "strong-types/slot_map.hpp"
+#include "strong-types/soa_vector.hpp"
+#include "strong-types/stable_id.hpp"
+#include "strong-types/strong.hpp"
+#include "strong-types/strong_id.hpp"
+#include "strong-types/time_index.hpp"
+#include "strong-types/time_series.hpp"
+#include "strong-types/unit_mdspan.hpp"
+#include "strong-types/unit_span.hpp"
+#include "strong-types/unit_suffix.hpp"
+#include "strong-types/unit_table.hpp"
+
+#if STRONG_TYPES_MODULE_FMT
+#include "strong-types/fmt.hpp"
+#endif
+
+#if STRONG_TYPES_PROFILING && !STRONG_TYPES_MODULE_FMT
+#error "STRONG_TYPES_PROFILING=1 needs {fmt}: build the module with STRONG_TYPES_MODULE_FMT=1"
+#endif
+
+export module strong_types;
+
+// ---- global-namespace names (AlignedArray, Scalar, always_false_v) ----
+
+export using ::always_false_v;
+export using ::Scalar;
+export using ::AlignedArray;
+export using ::operator+;
+export using ::operator-;
+export using ::operator*;
+export using ::operator/;
+
+export namespace strong_types
+{
+
+// ---- strong.hpp ----
+using strong_types::Arithmetic;
+using strong_types::difference_result;
+using strong_types::InPlaceAddable;
+using strong_types::InPlaceDivisible;
+using strong_types::InPlaceMultipliable;
+using strong_types::InPlaceSubtractable;
+using strong_types::is_strong_v;
+using strong_types::NotStrong;
+using strong_types::product_result;
+using strong_types::quotient_result;
+using strong_types::scalar_div_result_t;
+using strong_types::scalar_division_result;
+using strong_types::Strong;
+using strong_types::sum_result;
+using strong_types::tag_difference_result;
+using strong_types::tag_product_result;
+using strong_types::tag_quotient_result;
+using strong_types::tag_sum_result;
+using strong_types::ValueLayout;
+
+// ---- strong_id.hpp ----
+using strong_types::is_strong_id;
+using strong_types::StrongId;
+using strong_types::StrongIdType;
+using strong_types::StrongVector;
+
+// Operator overload sets (Strong, ScaledUnit, QuantityPoint)
+using strong_types::operator+;
+using strong_types::operator-;
+using strong_types::operator*;
+using strong_types::operator/;
+using strong_types::operator+=;
+using strong_types::operator-=;
+using strong_types::operator*=;
+using strong_types::operator/=;
+using strong_types::operator==;
+using strong_types::operator<=>;
+
+// ---- si.hpp ----
+using strong_types::AccelerationTag;
+using strong_types::AngularVelocityTag;
+using strong_types::AreaTag;
+using strong_types::CelsiusTag;
+using strong_types::DensityTag;
+using strong_types::EnergyTag;
+using strong_types::ForceTag;
+using strong_types::HertzTag;
+using strong_types::LengthTag;
+using strong_types::MassTag;
+using strong_types::PowerTag;
+using strong_types::PressureTag;
+using strong_types::RadianTag;
+using strong_types::SpeedTag;
+using strong_types::SteradianTag;
+using strong_types::TimeTag;
+using strong_types::TorqueTag;
+using strong_types::unit_t;
+using strong_types::VoltTag;
+using strong_types::VolumeTag;
+
+// ---- dimension.hpp ----
+using strong_types::Dimension;
+using strong_types::dimension_power_t;
+using strong_types::dimension_product_t;
+using strong_types::dimension_quotient_t;
+using strong_types::Dimensionless;
+using strong_types::is_dimension_v;
+
+// ---- si_scaled.hpp ----
+using strong_types::Centimeters;
+using strong_types::common_ratio_representable_v;
+using strong_types::common_ratio_t;
+using strong_types::Days;
+using strong_types::Grams;
+using strong_types::Hours;
+using strong_types::is_scaled_v;
+using strong_types::Kilometers;
+using strong_types::KilometersPerHour;
+using strong_types::Micrometers;
+using strong_types::Microseconds;
+using strong_types::Milligrams;
+using strong_types::Millimeters;
+using strong_types::Milliseconds;
+using strong_types::Minutes;
+using strong_types::Nanoseconds;
+using strong_types::NotScaled;
+using strong_types::SameTagScaled;
+using strong_types::scale_cast;
+using strong_types::ScaledUnit;
+using strong_types::Tons;
+using strong_types::Weeks;
+
+// ---- quantity_expr.hpp ----
+using strong_types::is_quantity_expr_v;
+using strong_types::lazy;
+using strong_types::QuantityExpr;
+
+// ---- quantity_point.hpp ----
+using strong_types::is_quantity_point_v;
+using strong_types::QuantityPoint;
+
+// ---- safe_math.hpp ----
+using strong_types::ArithmeticErrc;
+using strong_types::safe_add;
+using strong_types::safe_divide;
+using strong_types::safe_multiply;
+using strong_types::safe_scale_cast;
+using strong_types::safe_subtract;
+using strong_types::safe_to_base;
+using strong_types::unsigned_abs;
+
+// ---- si_chrono.hpp ----
+using strong_types::from_chrono;
+using strong_types::from_timespec;
+using strong_types::from_timespec_as_ns;
+using strong_types::time_unit_ratio;
+using strong_types::TimeUnit;
+using strong_types::to_chrono;
+using strong_types::to_chrono_as;
+using strong_types::to_nanoseconds;
+using strong_types::to_timespec;
+#if STRONG_TYPES_HAS_TIMEVAL
+using strong_types::from_timeval;
+using strong_types::from_timeval_as_us;
+using strong_types::to_timeval;
+#endif
+
+// ---- clock.hpp ----
+using strong_types::cpu_relax;
+using strong_types::from_time_point;
+using strong_types::period_from_rate;
+using strong_types::PeriodErrc;
+using strong_types::sleep_until;
+using strong_types::sleep_until_ns;
+using strong_types::spin_until_ns;
+using strong_types::steady_now;
+using strong_types::steady_now_ns;
+using strong_types::SteadyClockOrigin;
+using strong_types::SteadyTimePoint;
+using strong_types::time_since_origin;
+using strong_types::to_steady_point;
+using strong_types::to_time_point;
+
+// ---- periodic_loop.hpp / latency_histogram.hpp ----
+using strong_types::LatencyHistogram;
+using strong_types::LatenessHistogram;
+using strong_types::PeriodicLoop;
+
+// ---- rate_limiter.hpp ----
+using strong_types::BasicLeakyBucket;
+using strong_types::BasicTokenBucket;
+using strong_types::ConcurrentLeakyBucket;
+using strong_types::ConcurrentTokenBucket;
+using strong_types::LeakyBucket;
+using strong_types::Producers;
+using strong_types::TokenBucket;
+
+// ---- event_loop.hpp ----
+#if STRONG_TYPES_HAS_EPOLL
+using strong_types::EventLoop;
+using strong_types::SleepAwaiter;
+using strong_types::Task;
+using strong_types::until;
+using strong_types::sleep_for;
+#endif
+
+// ---- any_quantity.hpp ----
+using strong_types::AnyQuantity;
+using strong_types::AnyQuantityConvertible;
+using strong_types::AnyQuantityErrc;
+using strong_types::dimension_code_v;
+
+// ---- stable_id.hpp ----
+using strong_types::origin_id_v;
+using strong_types::origin_name;
+using strong_types::quantity_id_v;
+using strong_types::ratio_id_v;
+using strong_types::StableId;
+using strong_types::tag_id_v;
+using strong_types::tag_name;
+
+// ---- unit_suffix.hpp / unit_table.hpp ----
+using strong_types::conversion_factor;
+using strong_types::convert;
+using strong_types::find_unit;
+using strong_types::quantity_from;
+using strong_types::scaled_suffix;
+using strong_types::tag_suffix;
+using strong_types::unit_id_v;
+using strong_types::unit_table;
+using strong_types::UnitErrc;
+using strong_types::UnitId;
+using strong_types::UnitInfo;
+
+// ---- unit_span.hpp ----
+using strong_types::fill;
+using strong_types::mean;
+using strong_types::minmax;
+using strong_types::QuantityRef;
+using strong_types::QuantitySpan;
+using strong_types::scaled_span;
+using strong_types::SpanErrc;
+using strong_types::sum;
+using strong_types::unit_span;
+using strong_types::view_as;
+
+// ---- hash.hpp / flat_hash_map.hpp ----
+using strong_types::FlatHashMap;
+using strong_types::FlatMapLookup;
+using strong_types::raw_key_lookup;
+using strong_types::raw_key_lookup_v;
+using strong_types::StdHashable;
+
+// ---- radix_sort.hpp ----
+using strong_types::PARALLEL_RADIX_MIN_PER_THREAD;
+using strong_types::parallel_radix_sort;
+using strong_types::parallel_radix_sort_by_key;
+using strong_types::radix_sort;
+using strong_types::radix_sort_by_key;
+using strong_types::RadixSortable;
+using strong_types::RadixSortableRange;
+using strong_types::SortErrc;
+
+// ---- slot_map.hpp ----
+using strong_types::SlotHandle;
+using strong_types::SlotMap;
+
+// ---- soa_vector.hpp ----
+using strong_types::soa_vector;
+using strong_types::SOA_COLUMN_ALIGNMENT;
+using strong_types::SoaIterator;
+using strong_types::SoaRow;
+
+// ---- time_index.hpp ----
+using strong_types::IndexableQuantity;
+using strong_types::IndexErrc;
+using strong_types::TimeIndex;
+
+// ---- time_series.hpp ----
+using strong_types::SERIES_CHUNK_SIZE;
+using strong_types::SeriesErrc;
+using strong_types::TimeSeries;
+
+// ---- column_file.hpp ----
+#if STRONG_TYPES_HAS_MMAP
+using strong_types::column_header_for;
+using strong_types::COLUMN_DATA_OFFSET;
+using strong_types::COLUMN_FILE_MAGIC;
+using strong_types::COLUMN_FILE_VERSION;
+using strong_types::ColumnErrc;
+using strong_types::ColumnFileHeader;
+using strong_types::ColumnQuantity;
+using strong_types::element_code_v;
+using strong_types::MappedColumn;
+using strong_types::write_column;
+#endif
+
+#if STRONG_TYPES_HAS_MDSPAN
+// ---- unit_mdspan.hpp ----
+using strong_types::elementwise;
+using strong_types::layout_aligned_rows;
+using strong_types::layout_padded_rows;
+using strong_types::layout_tiled;
+using strong_types::quantity_accessor;
+using strong_types::quantity_mdspan;
+using strong_types::row_sums;
+using strong_types::scaled_mdspan;
+using strong_types::unit_mdspan;
+#endif
+
+} // namespace strong_types
+
+export namespace strong_types::dim
+{
+using strong_types::dim::Acceleration;
+using strong_types::dim::Amount;
+using strong_types::dim::Angle;
+using strong_types::dim::AngularVelocity;
+using strong_types::dim::Area;
+using strong_types::dim::Current;
+using strong_types::dim::Density;
+using strong_types::dim::Energy;
+using strong_types::dim::Force;
+using strong_types::dim::Frequency;
+using strong_types::dim::Impulse;
+using strong_types::dim::Jerk;
+using strong_types::dim::Length;
+using strong_types::dim::Luminosity;
+using strong_types::dim::Mass;
+using strong_types::dim::Power;
+using strong_types::dim::Pressure;
+using strong_types::dim::SolidAngle;
+using strong_types::dim::Speed;
+using strong_types::dim::Temperature;
+using strong_types::dim::Time;
+using strong_types::dim::Torque;
+using strong_types::dim::Volume;
+using strong_types::dim::Voltage;
+} // namespace strong_types::dim
+
+// ---- profiling.hpp (STRONG_TYPES_PROFILE_SCOPE itself still needs the #include) ----
+
+export namespace strong_types::profiling
+{
+using strong_types::profiling::CallSite;
+using strong_types::profiling::CallSiteStats;
+using strong_types::profiling::chrome_trace_json;
+using strong_types::profiling::collect_stats;
+using strong_types::profiling::format_summary;
+using strong_types::profiling::reset;
+using strong_types::profiling::ScopedTimer;
+using strong_types::profiling::TraceErrc;
+using strong_types::profiling::TraceEvent;
+using strong_types::profiling::write_chrome_trace;
+#if STRONG_TYPES_PROFILING
+using strong_types::profiling::Registry;
+using strong_types::profiling::this_thread_buffer;
+using strong_types::profiling::ThreadBuffer;
+#endif
+} // namespace strong_types::profiling
+
+// ---- literals ----
+
+export namespace strong_types::si_literals
+{
+using strong_types::si_literals::operator""_degC;
+using strong_types::si_literals::operator""_Hz;
+using strong_types::si_literals::operator""_J;
+using strong_types::si_literals::operator""_kg;
+using strong_types::si_literals::operator""_m;
+using strong_types::si_literals::operator""_m2;
+using strong_types::si_literals::operator""_m3;
+using strong_types::si_literals::operator""_mps;
+using strong_types::si_literals::operator""_mps2;
+using strong_types::si_literals::operator""_N;
+using strong_types::si_literals::operator""_Nm;
+using strong_types::si_literals::operator""_Pa;
+using strong_types::si_literals::operator""_rad;
+using strong_types::si_literals::operator""_rps;
+using strong_types::si_literals::operator""_s;
+using strong_types::si_literals::operator""_sr;
+using strong_types::si_literals::operator""_V;
+using strong_types::si_literals::operator""_W;
+} // namespace strong_types::si_literals
+
+export namespace strong_types::si_scaled_literals
+{
+using strong_types::si_scaled_literals::operator""_cm;
+using strong_types::si_scaled_literals::operator""_d;
+using strong_types::si_scaled_literals::operator""_g;
+using strong_types::si_scaled_literals::operator""_hr;
+using strong_types::si_scaled_literals::operator""_km;
+using strong_types::si_scaled_literals::operator""_kmh;
+using strong_types::si_scaled_literals::operator""_mg;
+using strong_types::si_scaled_literals::operator""_min;
+using strong_types::si_scaled_literals::operator""_mm;
+using strong_types::si_scaled_literals::operator""_ms;
+using strong_types::si_scaled_literals::operator""_ns;
+using strong_types::si_scaled_literals::operator""_t;
+using strong_types::si_scaled_literals::operator""_um;
+using strong_types::si_scaled_literals::operator""_us;
+using strong_types::si_scaled_literals::operator""_wk;
+} // namespace strong_types::si_scaled_literals
+
+#if STRONG_TYPES_MODULE_FMT
+// Keep the formatter partial specializations reachable from importers
+export namespace fmt
+{
+using fmt::formatter;
+} // namespace fmt
+#endif
@@ -0,0 +1,102 @@
+// NOLINTBEGIN(readability-magic-numbers) — test file
+#include "strong-types/any_quantity.hpp"
+#include "strong-types/si_literals.hpp"
+#include "strong-types/si_scaled_literals.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <ratio>
+#include <type_traits>
+
+using namespace strong_types;
+using namespace strong_types::si_literals;
+using namespace strong_types::si_scaled_literals;
+
+using Meters = unit_t<double, LengthTag>;
+using Seconds = unit_t<double, TimeTag>;
+using IntMeters = unit_t<std::int64_t, LengthTag>;
+using IntMillimeters = Millimeters<std::int64_t>;
+
+// ---- descriptor ----
+
+static_assert(sizeof(AnyQuantity) == 24, "value, scale and packed dimension");
+static_assert(AnyQuantity{5.0_km}.exponent(0) == 1 && AnyQuantity{5.0_km}.exponent(2) == 0, "length exponent");
+static_assert(AnyQuantity{3.0_mps2}.exponent(2) == -2, "negative exponents survive packing");
+static_assert(AnyQuantity{2.0_N}.dimension_code() == dimension_code_v<dim::Force>, "named tag == dim:: equivalent");
+static_assert(AnyQuantity{1.0_km}.holds<Kilometers<double>>() && !AnyQuantity{1.0_km}.holds<Meters>(), "holds");
+static_assert(AnyQuantity{1.0_km}.same_dimension<Meters>() && !AnyQuantity{1.0_km}.same_dimension<Seconds>(),
+              "same_dimension");
+
+// ---- casts ----
+
+static_assert(AnyQuantity{2.5_km}.as<Kilometers<double>>().value().get() == 2.5, "fast path: identical descriptor");
+static_assert(AnyQuantity{2.5_km}.as<Meters>().value().get() == 2500.0, "rescaled cast");
+static_assert(AnyQuantity{90.0_min}.as<Hours<float>>().value().get() == 1.5F, "value type converts");
+static_assert(AnyQuantity{2.5_km}.as<Seconds>().error() == AnyQuantityErrc::dimension_mismatch, "checked");
+
+// ---- arithmetic ----
+
+static_assert(AnyQuantity{1.0_km}.plus(AnyQuantity{250.0_m}).value().as<Meters>().value().get() == 1250.0,
+              "sum lands in the finer scale");
+static_assert(AnyQuantity{1.0_km}.plus(AnyQuantity{250.0_m}).value().scale() == 1.0, "finer scale kept");
+static_assert(AnyQuantity{1.0_km}.minus(AnyQuantity{1.0_s}).error() == AnyQuantityErrc::dimension_mismatch,
+              "length - time");
+
+static_assert([]
+              {
+    const auto speed = AnyQuantity{10.0_m} / AnyQuantity{2.0_s};
+    const auto force = AnyQuantity{3.0_kg} * AnyQuantity{2.0_mps2};
+    return speed.as<unit_t<double, SpeedTag>>().value().get() == 5.0 &&
+           force.as<unit_t<double, ForceTag>>().value().get() == 6.0 &&
+           force.dimension_code() == dimension_code_v<ForceTag>; }(), "runtime dimensional algebra");
+
+static_assert([]
+              {
+    const auto ratio = AnyQuantity{1.0_km} / AnyQuantity{250.0_m};
+    return ratio.dimension_code() == 0 && ratio.as<unit_t<double, void>>().value().get() == 4.0; }(),
+              "dimensionless quotient");
+
+static_assert((AnyQuantity{2.0_km} * 3.0).as<Kilometers<double>>().value().get() == 6.0, "scalar multiply");
+static_assert((-AnyQuantity{2.0_s}).value() == -2.0, "negate");
+
+// ---- integral payloads: held as int64, never rounded through double ----
+
+constexpr std::int64_t ABOVE_2_53 = (std::int64_t{1} << 53) + 1; // first integer a double cannot hold
+constexpr std::int64_t INT64_MAX_VALUE = std::numeric_limits<std::int64_t>::max();
+
+static_assert(AnyQuantity{IntMeters{ABOVE_2_53}}.is_integral() && !AnyQuantity{2.5_km}.is_integral(), "payload kind");
+static_assert(AnyQuantity{IntMeters{ABOVE_2_53}}.as<IntMeters>().value().get() == ABOVE_2_53, "int64 round trip");
+static_assert(AnyQuantity{IntMeters{INT64_MAX_VALUE}}.as<IntMeters>().value().get() == INT64_MAX_VALUE, "int64 max");
+static_assert(AnyQuantity{IntMeters{ABOVE_2_53}}.scale() == 1.0 &&
+                  AnyQuantity{IntMeters{ABOVE_2_53}}.holds<IntMeters>(),
+              "scale reads back positive");
+static_assert(AnyQuantity{IntMeters{ABOVE_2_53}}.as<IntMillimeters>().value().get() == ABOVE_2_53 * 1000,
+              "whole-factor rescale is an exact multiply");
+static_assert(AnyQuantity{IntMillimeters{std::int64_t{-1999}}}.as<IntMeters>().value().get() == -1,
+              "finer to coarser truncates toward zero");
+static_assert(AnyQuantity{IntMeters{ABOVE_2_53}}.plus(AnyQuantity{IntMillimeters{std::int64_t{1}}}).value()
+                      .as<IntMillimeters>().value().get() == (ABOVE_2_53 * 1000) + 1,
+              "integral sums stay exact");
+static_assert((AnyQuantity{IntMeters{ABOVE_2_53}} * AnyQuantity{IntMeters{std::int64_t{2}}})
+                      .as<unit_t<std::int64_t, AreaTag>>().value().get() == ABOVE_2_53 * 2,
+              "integral products stay exact");
+static_assert((-AnyQuantity{IntMeters{ABOVE_2_53}}).as<IntMeters>().value().get() == -ABOVE_2_53, "integral negate");
+
+// Results that leave int64 fall back to double; casts that do not fit the target fail
+static_assert(
+    !AnyQuantity{IntMeters{INT64_MAX_VALUE}}.plus(AnyQuantity{IntMeters{std::int64_t{1}}}).value().is_integral(),
+    "overflowing sum becomes a double");
+static_assert(AnyQuantity{IntMeters{INT64_MAX_VALUE}}.as<IntMillimeters>().error() == AnyQuantityErrc::out_of_range,
+              "rescale overflow");
+static_assert(AnyQuantity{IntMeters{ABOVE_2_53}}.as<unit_t<std::int32_t, LengthTag>>().error() ==
+                  AnyQuantityErrc::out_of_range,
+              "narrower integral target");
+static_assert(AnyQuantity{Meters{1e300}}.as<IntMeters>().error() == AnyQuantityErrc::out_of_range,
+              "double payload outside int64");
+static_assert(AnyQuantity{Meters{-2.75}}.as<IntMeters>().value().get() == -2, "double payload truncates");
+
+static_assert(std::is_constructible_v<AnyQuantity, unit_t<std::uint32_t, LengthTag>> &&
+                  !std::is_constructible_v<AnyQuantity, unit_t<std::uint64_t, LengthTag>>,
+              "reps that do not fit int64 are rejected");
+
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,173 @@
+// NOLINTBEGIN(readability-magic-numbers) — test file
+#include <doctest/doctest.h>
+
+#include "strong-types/clock.hpp"
+#include "strong-types/column_file.hpp"
+#include "strong-types/si.hpp"
+#include "strong-types/si_scaled.hpp"
+
+#if STRONG_TYPES_HAS_MMAP
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace strong_types;
+
+namespace
+{
+
+using Depth = unit_t<double, LengthTag>;
+
+/// Per-run prefix, so concurrent runs of this test do not share scratch files
+const std::string &run_prefix()
+{
+    static const std::string prefix = std::to_string(std::random_device{}()) + "_";
+    return prefix;
+}
+
+/// A scratch file under the temp directory, removed when the test case ends
+class TempFile
+{
+public:
+    explicit TempFile(const char *name)
+        : path_((std::filesystem::temp_directory_path() / (run_prefix() + name)).string())
+    {
+    }
+
+    TempFile(const TempFile &) = delete;
+    TempFile &operator=(const TempFile &) = delete;
+
+    ~TempFile()
+    {
+        std::error_code ignored;
+        std::filesystem::remove(path_, ignored);
+    }
+
+    [[nodiscard]] const char *c_str() const noexcept
+    {
+        return path_.c_str();
+    }
+
+private:
+    std::string path_;
+};
+
+std::vector<Depth> depths(std::size_t count)
+{
+    std::vector<Depth> values;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        values.emplace_back(static_cast<double>(i) * 0.5);
+    }
+    return values;
+}
+
+} // namespace
+
+TEST_CASE("column files round-trip through a read-only mapping")
+{
+    const TempFile file{"roundtrip.col"};
+    const auto values = depths(1000);
+    REQUIRE(write_column(file.c_str(), std::span<const Depth>{values}));
+
+    auto column = MappedColumn<Depth>::open(file.c_str());
+    REQUIRE(column);
+    CHECK(column->size() == 1000);
+    CHECK(column->header().tag_id == tag_id_v<LengthTag>);
+    CHECK(column->header().element_code == element_code_v<double>);
+    CHECK((*column)[7] == Depth{3.5});
+    CHECK(sum(column->view()) == sum(unit_span<const double, LengthTag>{&values[0].get(), values.size()}));
+    CHECK(reinterpret_cast<std::uintptr_t>(column->view().raw().data()) % COLUMN_DATA_OFFSET == 0);
+
+    const auto moved = std::move(*column);
+    CHECK(moved.size() == 1000);
+}
+
+TEST_CASE("column files accept QuantitySpans, scaled units and time points")
+{
+    const TempFile scaled{"scaled.col"};
+    std::vector<float> raw{1.0F, 2.0F, 3.0F};
+    REQUIRE(write_column(scaled.c_str(), scaled_span<float, LengthTag, std::milli>{raw.data(), raw.size()}));
+    const auto mm = MappedColumn<Millimeters<float>>::open(scaled.c_str());
+    REQUIRE(mm);
+    CHECK(mm->header().ratio_den == 1000);
+    CHECK((*mm)[2] == Millimeters<float>{3.0F});
+
+    const TempFile stamps{"stamps.col"};
+    const std::vector<SteadyTimePoint<std::int64_t>> points{SteadyTimePoint<std::int64_t>{std::int64_t{5}}};
+    REQUIRE(write_column(stamps.c_str(), std::span{points}));
+    CHECK(MappedColumn<SteadyTimePoint<std::int64_t>>::open(stamps.c_str()));
+    CHECK(MappedColumn<unit_t<std::int64_t, TimeTag>>::open(stamps.c_str()).error() == ColumnErrc::unit_mismatch);
+
+    const TempFile empty{"empty.col"};
+    REQUIRE(write_column(empty.c_str(), std::span<const Depth>{}));
+    const auto none = MappedColumn<Depth>::open(empty.c_str());
+    REQUIRE(none);
+    CHECK(none->view().empty());
+}
+
+TEST_CASE("rewriting a column file leaves existing mappings intact")
+{
+    const TempFile file{"rewrite.col"};
+    const auto first = depths(4096);
+    REQUIRE(write_column(file.c_str(), std::span<const Depth>{first}));
+    auto before = MappedColumn<Depth>::open(file.c_str());
+    REQUIRE(before);
+
+    // A shorter replacement: truncating in place would SIGBUS the old mapping's tail pages
+    const std::vector<Depth> second{Depth{-1.0}, Depth{-2.0}};
+    REQUIRE(write_column(file.c_str(), std::span<const Depth>{second}));
+    CHECK(before->size() == 4096);
+    CHECK((*before)[4095] == first[4095]);
+
+    auto after = MappedColumn<Depth>::open(file.c_str());
+    REQUIRE(after);
+    CHECK(after->size() == 2);
+    CHECK((*after)[1] == Depth{-2.0});
+
+    // No temporary is left beside the target
+    std::size_t entries = 0;
+    const std::string prefix = std::filesystem::path{file.c_str()}.filename().string();
+    for (const auto &entry : std::filesystem::directory_iterator{std::filesystem::temp_directory_path()})
+    {
+        entries += entry.path().filename().string().starts_with(prefix) ? 1U : 0U;
+    }
+    CHECK(entries == 1);
+    CHECK(write_column("/nonexistent/strong_types.col", std::span<const Depth>{second}).error() ==
+          ColumnErrc::open_failed);
+}
+
+TEST_CASE("column files are checked against the requested type at open")
+{
+    const TempFile file{"checked.col"};
+    const auto values = depths(16);
+    REQUIRE(write_column(file.c_str(), std::span<const Depth>{values}));
+
+    CHECK(MappedColumn<Millimeters<double>>::open(file.c_str()).error() == ColumnErrc::unit_mismatch);
+    CHECK(MappedColumn<unit_t<double, MassTag>>::open(file.c_str()).error() == ColumnErrc::unit_mismatch);
+    CHECK(MappedColumn<unit_t<float, LengthTag>>::open(file.c_str()).error() == ColumnErrc::type_mismatch);
+    CHECK(MappedColumn<unit_t<std::int64_t, LengthTag>>::open(file.c_str()).error() == ColumnErrc::type_mismatch);
+    CHECK(MappedColumn<Depth>::open("/nonexistent/strong_types.col").error() == ColumnErrc::open_failed);
+
+    std::filesystem::resize_file(file.c_str(), COLUMN_DATA_OFFSET + 15 * sizeof(double));
+    CHECK(MappedColumn<Depth>::open(file.c_str()).error() == ColumnErrc::truncated);
+    std::filesystem::resize_file(file.c_str(), 10);
+    CHECK(MappedColumn<Depth>::open(file.c_str()).error() == ColumnErrc::truncated);
+
+    const TempFile garbage{"garbage.col"};
+    {
+        std::ofstream out{garbage.c_str(), std::ios::binary};
+        out << std::string(128, 'x');
+    }
+    CHECK(MappedColumn<Depth>::open(garbage.c_str()).error() == ColumnErrc::bad_header);
+}
+
+#endif // STRONG_TYPES_HAS_MMAP
+
+// NOLINTEND(readability-magic-numbers)
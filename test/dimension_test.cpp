@@ -0,0 +1,71 @@
+#include "strong-types/dimension.hpp"
+#include "strong-types/si_scaled.hpp"
+
+#include <ratio>
+#include <type_traits>
+
+using namespace strong_types;
+
+// ---- exponent arithmetic ----
+
+static_assert(std::is_same_v<dimension_product_t<dim::Length, dim::Length>, dim::Area>, "L * L = L^2");
+static_assert(std::is_same_v<dimension_quotient_t<dim::Volume, dim::Area>, dim::Length>, "L^3 / L^2 = L");
+static_assert(std::is_same_v<dimension_quotient_t<dim::Length, dim::Length>, void>, "dimensionless → void");
+static_assert(std::is_same_v<dimension_power_t<dim::Time, -2>, Dimension<0, 0, -2>>, "T^-2");
+static_assert(dim::Jerk::length == 1 && dim::Jerk::time == -3, "jerk = m/s^3");
+static_assert(dim::Energy::mass == 1 && dim::Energy::length == 2 && dim::Energy::time == -2, "J = kg m^2 s^-2");
+static_assert(is_dimension_v<dim::Force> && !is_dimension_v<void> && !is_dimension_v<int>, "detector");
+
+// ---- angle keeps look-alike quantities apart ----
+
+static_assert(!std::is_same_v<dim::AngularVelocity, dim::Frequency>, "rad/s is not Hz");
+static_assert(!std::is_same_v<dim::Torque, dim::Energy>, "N·m/rad is not J");
+static_assert(std::is_same_v<dimension_product_t<dim::Torque, dim::AngularVelocity>, dim::Power>, "τ·ω = P");
+static_assert(std::is_same_v<dimension_product_t<dim::Angle, dim::Angle>, dim::SolidAngle>, "rad^2 = sr");
+
+// ---- quantities on Dimension tags need no table entries ----
+
+using Meters = unit_t<double, dim::Length>;
+using Seconds = unit_t<double, dim::Time>;
+using Newtons = unit_t<double, dim::Force>;
+using MetersPerSecondCubed = unit_t<double, dim::Jerk>;
+
+static_assert([]
+              {
+    constexpr Meters d{12.0};
+    constexpr Seconds t{2.0};
+    constexpr MetersPerSecondCubed j = d / t / t / t;
+    return j.get() == 1.5; }(), "jerk derived without a trait specialization");
+
+static_assert([]
+              {
+    constexpr Newtons f{10.0};
+    constexpr Seconds t{3.0};
+    constexpr unit_t<double, dim::Impulse> p = f * t;
+    return p.get() == 30.0; }(), "N·s");
+
+static_assert([]
+              {
+    constexpr unit_t<double, dim::Power> p{500.0};
+    constexpr unit_t<double, dim::Area> a{2.0};
+    constexpr unit_t<double, dimension_quotient_t<dim::Power, dim::Area>> irradiance = p / a;
+    return irradiance.get() == 250.0; }(), "W/m^2");
+
+static_assert([]
+              {
+    constexpr Meters a{3.0};
+    constexpr Meters b{4.0};
+    constexpr double ratio = a / b;
+    constexpr Meters sum = a + b;
+    return ratio == 0.75 && sum.get() == 7.0; }(), "same-dimension quotient is a plain scalar, sums keep the tag");
+
+static_assert([]
+              {
+    constexpr unit_t<double, void> one{1.0};
+    constexpr unit_t<double, dim::Frequency> hz = one / Seconds{0.5};
+    return hz.get() == 2.0; }(), "1 / s = Hz");
+
+static_assert([]
+              {
+    constexpr ScaledUnit<double, dim::Length, std::kilo> km{1.5};
+    return km.to_base().get() == 1500.0; }(), "Dimension tags work with ScaledUnit");
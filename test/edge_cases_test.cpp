@@ -3,6 +3,8 @@
 #include "strong-types/si_scaled.hpp"
 #include "strong-types/si_scaled_literals.hpp"
 
+#include <type_traits>
+
 using namespace strong_types;
 using namespace strong_types::si_literals;
 using namespace strong_types::si_scaled_literals;
@@ -118,24 +120,25 @@ static_assert(KilometersPerHour<double>{}.get() == 0.0, "default km/h is 0");
 static_assert(
     [] {
         constexpr auto result = 1.0_km + 500000.0_mm;
-        return result.get() == 1500.0;
+        static_assert(std::is_same_v<std::remove_cvref_t<decltype(result)>, Millimeters<double>>);
+        return result.get() == 1500000.0;
     }(),
-    "km + mm = base meters");
+    "km + mm = mm");
 
 static_assert(
     [] {
         constexpr auto result = 1.0_hr + 1000000000.0_ns;
         constexpr double expected = 3601.0;
-        return result.get() > expected - 0.001 && result.get() < expected + 0.001;
+        return result.to_base().get() > expected - 0.001 && result.to_base().get() < expected + 0.001;
     }(),
-    "hr + ns = base seconds");
+    "hr + ns = ns");
 
 static_assert(
     [] {
         constexpr auto result = 1.0_km + 100.0_um;
-        return result.get() > 1000.0 && result.get() < 1000.001;
+        return result.get() == 1000000100.0;
     }(),
-    "km + um = base meters");
+    "km + um = um");
 
 // ---- New unit dimensional algebra: Power ----
 
@@ -389,9 +392,9 @@ static_assert((1.0_t).to_base().get() == 1000.0, "1t = 1000kg");
 static_assert(
     [] {
         constexpr auto result = 1.0_t + 500.0_g;
-        return result.get() > 1000.4999 && result.get() < 1000.5001;
+        return result.get() == 1000500.0;
     }(),
-    "1t + 500g = 1000.5kg");
+    "1t + 500g = 1000500g");
 
 static_assert(
     [] {
@@ -405,9 +408,9 @@ static_assert(
 static_assert(
     [] {
         constexpr auto result = 1.0_wk + 1.0_d;
-        return result.get() == 691200.0;
+        return result.get() == 8.0 && result.to_base().get() == 691200.0;
     }(),
-    "1wk + 1d = 8 days in seconds");
+    "1wk + 1d = 8 days");
 
 static_assert(
     [] {
@@ -0,0 +1,156 @@
+// NOLINTBEGIN(readability-magic-numbers) — test file
+#include <doctest/doctest.h>
+
+#include "strong-types/event_loop.hpp"
+#include "strong-types/si_scaled_literals.hpp"
+
+#if STRONG_TYPES_HAS_EPOLL
+
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <type_traits>
+#include <vector>
+
+using namespace strong_types;
+using namespace strong_types::si_scaled_literals;
+
+namespace
+{
+
+Task sleep_then_record(Milliseconds<double> delay, int id, std::vector<int> &order)
+{
+    co_await sleep_for(delay);
+    order.push_back(id);
+}
+
+Task wait_until(SteadyTimePoint<double> deadline, SteadyTimePoint<double> &woke)
+{
+    co_await until(deadline);
+    woke = steady_now();
+}
+
+Task tick(int times, int &count)
+{
+    for (int i = 0; i < times; ++i)
+    {
+        co_await sleep_for(100.0_us);
+        ++count;
+    }
+}
+
+Task past_deadline(bool &done)
+{
+    co_await until(steady_now() - 1.0_ms);
+    done = true;
+}
+
+// Minimal eager coroutine that is not a Task, to await outside any loop
+struct Detached
+{
+    struct promise_type
+    {
+        Detached get_return_object() const noexcept
+        {
+            return {};
+        }
+        std::suspend_never initial_suspend() const noexcept
+        {
+            return {};
+        }
+        std::suspend_never final_suspend() const noexcept
+        {
+            return {};
+        }
+        void return_void() const noexcept
+        {
+        }
+        void unhandled_exception() const noexcept
+        {
+            std::terminate();
+        }
+    };
+};
+
+Detached detached_sleep(Milliseconds<double> delay, bool &done)
+{
+    co_await sleep_for(delay);
+    done = true;
+}
+
+static_assert(!std::is_copy_constructible_v<EventLoop> && !std::is_move_constructible_v<EventLoop>);
+
+} // namespace
+
+TEST_CASE("EventLoop::create succeeds and run() returns with no tasks")
+{
+    auto loop = EventLoop::create();
+    REQUIRE(loop.has_value());
+    CHECK(EventLoop::current() == nullptr);
+    CHECK(loop->run().has_value());
+    CHECK(loop->active_tasks() == 0);
+}
+
+TEST_CASE("sleep_for resumes tasks in deadline order")
+{
+    auto loop = EventLoop::create();
+    REQUIRE(loop.has_value());
+    std::vector<int> order;
+    loop->spawn(sleep_then_record(6.0_ms, 3, order));
+    loop->spawn(sleep_then_record(2.0_ms, 1, order));
+    loop->spawn(sleep_then_record(4.0_ms, 2, order));
+    CHECK(loop->active_tasks() == 3);
+
+    CHECK(loop->run().has_value());
+    CHECK(order == std::vector<int>{1, 2, 3});
+    CHECK(loop->active_tasks() == 0);
+    CHECK(loop->pending_timers() == 0);
+}
+
+TEST_CASE("until wakes no earlier than a steady-clock deadline")
+{
+    auto loop = EventLoop::create();
+    REQUIRE(loop.has_value());
+    const auto deadline = steady_now() + 3.0_ms;
+    SteadyTimePoint<double> woke{};
+    loop->spawn(wait_until(deadline, woke));
+    CHECK(loop->run().has_value());
+    CHECK(woke >= deadline);
+}
+
+TEST_CASE("a task awaits repeatedly and a past deadline does not suspend")
+{
+    auto loop = EventLoop::create();
+    REQUIRE(loop.has_value());
+    int count = 0;
+    bool done = false;
+    loop->spawn(tick(25, count));
+    loop->spawn(past_deadline(done));
+    CHECK(loop->run().has_value());
+    CHECK(count == 25);
+    CHECK(done);
+}
+
+TEST_CASE("destroying a loop frees tasks that never ran")
+{
+    std::vector<int> order;
+    {
+        auto loop = EventLoop::create();
+        REQUIRE(loop.has_value());
+        loop->spawn(sleep_then_record(1.0_ms, 1, order));
+    }
+    CHECK(order.empty());
+}
+
+TEST_CASE("awaiting with no loop blocks until the deadline instead of suspending")
+{
+    bool done = false;
+    const auto begin = steady_now();
+    detached_sleep(2.0_ms, done);
+    CHECK(done);
+    CHECK(steady_now() - begin >= 2.0_ms);
+}
+
+#endif // STRONG_TYPES_HAS_EPOLL
+
+// NOLINTEND(readability-magic-numbers)
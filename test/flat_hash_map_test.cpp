@@ -0,0 +1,168 @@
+// NOLINTBEGIN(readability-magic-numbers) — test file
+#include <doctest/doctest.h>
+
+#include "strong-types/flat_hash_map.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace app
+{
+struct EntityIdTag;
+struct SensorIdTag;
+} // namespace app
+
+template <>
+struct strong_types::raw_key_lookup<app::EntityIdTag> : std::true_type
+{
+};
+
+using namespace strong_types;
+
+namespace
+{
+
+using EntityId = Strong<std::uint64_t, app::EntityIdTag>;
+using SensorId = Strong<std::uint64_t, app::SensorIdTag>;
+using Meters = unit_t<double, LengthTag>;
+
+template <typename Map, typename L>
+concept FindableBy = requires(const Map &map, const L &key) { map.find(key); };
+
+/// Every key lands in the same group and h2, so probing and key comparison do all the work
+struct CollidingHash
+{
+    std::size_t operator()(const EntityId & /*unused*/) const noexcept
+    {
+        return 7;
+    }
+};
+
+} // namespace
+
+// ---- std::hash ----
+
+static_assert(FindableBy<FlatHashMap<EntityId, int>, EntityId>);
+static_assert(FindableBy<FlatHashMap<EntityId, int>, std::uint64_t>);
+static_assert(!FindableBy<FlatHashMap<SensorId, int>, std::uint64_t>);
+static_assert(!FindableBy<FlatHashMap<EntityId, int>, SensorId>);
+
+TEST_CASE("std::hash of a quantity is the hash of its value")
+{
+    CHECK(std::hash<EntityId>{}(EntityId{std::uint64_t{9}}) == std::hash<std::uint64_t>{}(9));
+    CHECK(std::hash<Millimeters<double>>{}(Millimeters<double>{2.5}) == std::hash<double>{}(2.5));
+    using Stamp = QuantityPoint<std::int64_t, TimeTag>;
+    CHECK(std::hash<Stamp>{}(Stamp{std::int64_t{5}}) == std::hash<std::int64_t>{}(5));
+    CHECK(std::hash<StrongId<std::uint32_t, app::SensorIdTag>>{}(StrongId<std::uint32_t, app::SensorIdTag>{3U}) ==
+          std::hash<std::uint32_t>{}(3U));
+
+    std::unordered_set<Meters> lengths{Meters{1.0}, Meters{2.0}, Meters{1.0}};
+    CHECK(lengths.size() == 2);
+}
+
+// ---- FlatHashMap ----
+
+TEST_CASE("FlatHashMap insert, find, erase")
+{
+    FlatHashMap<EntityId, int> map;
+    CHECK(map.empty());
+    CHECK(map.find(EntityId{std::uint64_t{1}}) == map.end());
+
+    CHECK(map.try_emplace(EntityId{std::uint64_t{1}}, 10).second);
+    CHECK_FALSE(map.try_emplace(EntityId{std::uint64_t{1}}, 99).second);
+    map[EntityId{std::uint64_t{2}}] = 20;
+    map.insert_or_assign(EntityId{std::uint64_t{1}}, 11);
+    CHECK(map.size() == 2);
+    CHECK(map.find(EntityId{std::uint64_t{1}})->second == 11);
+    CHECK(map.find(std::uint64_t{2})->second == 20); // raw lookup: EntityIdTag opts in
+    CHECK(map.contains(std::uint64_t{2}));
+
+    CHECK(map.erase(EntityId{std::uint64_t{1}}) == 1);
+    CHECK(map.erase(std::uint64_t{1}) == 0);
+    CHECK_FALSE(map.contains(EntityId{std::uint64_t{1}}));
+    CHECK(map.size() == 1);
+}
+
+TEST_CASE("FlatHashMap agrees with unordered_map under churn")
+{
+    FlatHashMap<EntityId, std::uint64_t> map;
+    std::unordered_map<std::uint64_t, std::uint64_t> reference;
+    std::uint64_t state = 12345;
+    for (int op = 0; op < 20000; ++op)
+    {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        const std::uint64_t key = (state >> 33U) % 512U;
+        if ((state & 3U) == 0)
+        {
+            CHECK(map.erase(key) == reference.erase(key));
+        }
+        else
+        {
+            map[EntityId{key}] = state;
+            reference[key] = state;
+        }
+    }
+    CHECK(map.size() == reference.size());
+    std::size_t visited = 0;
+    for (const auto &[key, value] : map)
+    {
+        REQUIRE(reference.contains(key.get()));
+        CHECK(reference[key.get()] == value);
+        ++visited;
+    }
+    CHECK(visited == reference.size());
+}
+
+TEST_CASE("FlatHashMap grows, reserves and survives full collisions")
+{
+    FlatHashMap<EntityId, int, CollidingHash> colliding;
+    for (std::uint64_t i = 0; i < 100; ++i)
+    {
+        colliding[EntityId{i}] = static_cast<int>(i);
+    }
+    for (std::uint64_t i = 0; i < 100; i += 2)
+    {
+        colliding.erase(EntityId{i});
+    }
+    CHECK(colliding.size() == 50);
+    CHECK(colliding.find(EntityId{std::uint64_t{51}})->second == 51);
+    CHECK_FALSE(colliding.contains(EntityId{std::uint64_t{50}}));
+
+    FlatHashMap<EntityId, int> reserved;
+    reserved.reserve(1000);
+    const auto capacity = reserved.capacity();
+    for (std::uint64_t i = 0; i < 1000; ++i)
+    {
+        reserved.try_emplace(EntityId{i}, 1);
+    }
+    CHECK(reserved.capacity() == capacity);
+    CHECK(capacity % FlatHashMap<EntityId, int>::GROUP_WIDTH == 0);
+}
+
+TEST_CASE("FlatHashMap owns non-trivial values")
+{
+    FlatHashMap<EntityId, std::shared_ptr<std::string>> map;
+    auto shared = std::make_shared<std::string>("pose");
+    for (std::uint64_t i = 0; i < 64; ++i)
+    {
+        map.try_emplace(EntityId{i}, shared);
+    }
+    CHECK(shared.use_count() == 65);
+
+    auto copy = map;
+    CHECK(shared.use_count() == 129);
+    auto moved = std::move(copy);
+    CHECK(moved.size() == 64);
+
+    map.erase(map.begin());
+    CHECK(shared.use_count() == 128);
+    map.clear();
+    moved = FlatHashMap<EntityId, std::shared_ptr<std::string>>{};
+    CHECK(shared.use_count() == 1);
+}
+
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,110 @@
+// NOLINTBEGIN(readability-magic-numbers,readability-identifier-length) — test file
+#include "strong-types/latency_histogram.hpp"
+#include "strong-types/si_scaled_literals.hpp"
+
+#include <cstdint>
+
+using namespace strong_types;
+using namespace strong_types::si_scaled_literals;
+
+// 3 precision bits (12.5 % resolution), 16-bit range — small enough to reason about by hand
+using SmallHistogram = LatencyHistogram<3, 16>;
+
+// ---- bounded memory ----
+
+static_assert(SmallHistogram::BUCKET_COUNT == 112, "(16 - 3 + 1) * 8 buckets");
+static_assert(LatencyHistogram<>::BUCKET_COUNT == 34 * 128, "default: 7 bits over 40-bit range");
+
+// ---- index mapping: linear below 2^(P+1), log-linear above ----
+
+static_assert(SmallHistogram::index_of(0) == 0, "zero");
+static_assert(SmallHistogram::index_of(-5) == 0, "negative clamps to zero");
+static_assert(SmallHistogram::index_of(15) == 15, "linear range is exact");
+static_assert(SmallHistogram::index_of(16) == 16 && SmallHistogram::index_of(17) == 16, "first log bucket is 2 wide");
+static_assert(SmallHistogram::lowest_equivalent(63) == 960 && SmallHistogram::highest_equivalent(63) == 1023,
+              "bucket 63 covers [960, 1023]");
+static_assert(SmallHistogram::index_of(1000) == 63, "1000 lands in [960, 1023]");
+
+static_assert(
+    [] {
+        // every bucket's range maps back onto itself and buckets tile the value range without gaps
+        for (std::size_t i = 0; i + 1 < SmallHistogram::BUCKET_COUNT; ++i)
+        {
+            if (SmallHistogram::index_of(SmallHistogram::lowest_equivalent(i)) != i ||
+                SmallHistogram::index_of(SmallHistogram::highest_equivalent(i)) != i ||
+                SmallHistogram::highest_equivalent(i) + 1 != SmallHistogram::lowest_equivalent(i + 1))
+            {
+                return false;
+            }
+        }
+        return SmallHistogram::highest_equivalent(SmallHistogram::BUCKET_COUNT - 1) == SmallHistogram::MAX_TRACKABLE;
+    }(),
+    "buckets tile [0, 2^16)");
+
+// ---- percentiles within 2^-P relative error, clamped to exact min/max ----
+
+static_assert(
+    [] {
+        SmallHistogram h;
+        for (std::int64_t ns = 1; ns <= 100; ++ns)
+        {
+            h.record_ns(ns);
+        }
+        return h.count() == 100 && h.percentile(0.0).get() == 1 && h.percentile(50.0).get() == 51 &&
+               h.percentile(100.0).get() == 100 && h.min().get() == 1 && h.max().get() == 100 &&
+               h.mean().get() == 50.5;
+    }(),
+    "percentiles over 1..100 ns");
+
+// ---- typed recording from any TimeUnit ----
+
+static_assert(
+    [] {
+        LatencyHistogram<> h;
+        h.record(2.0_us);
+        h.record(Nanoseconds<std::int64_t>{std::int64_t{2000}}, 3);
+        h.record(Milliseconds<std::int64_t>{std::int64_t{1}});
+        const auto p50 = h.percentile(50.0).get();
+        return h.count() == 5 && p50 >= 2000 && p50 <= 2000 + 2000 / 128 && h.max().get() == 1'000'000;
+    }(),
+    "record() accepts any TimeUnit");
+
+static_assert(std::is_same_v<decltype(LatencyHistogram<>{}.percentile(99.9)), Nanoseconds<std::int64_t>>,
+              "percentiles are typed");
+
+// ---- saturation keeps exact max ----
+
+static_assert(
+    [] {
+        SmallHistogram h;
+        h.record_ns(std::int64_t{1} << 20);
+        return h.bucket(SmallHistogram::BUCKET_COUNT - 1) == 1 && h.max().get() == (std::int64_t{1} << 20) &&
+               h.percentile(99.0).get() == (std::int64_t{1} << 20);
+    }(),
+    "out-of-range samples saturate the top bucket");
+
+// ---- merge ----
+
+static_assert(
+    [] {
+        SmallHistogram a;
+        SmallHistogram b;
+        a.record_ns(10);
+        a.record_ns(20);
+        b.record_ns(5);
+        b.record_ns(1000);
+        a.merge(b);
+        return a.count() == 4 && a.min().get() == 5 && a.max().get() == 1000 && a.percentile(50.0).get() == 10;
+    }(),
+    "merge combines counts and extremes");
+
+static_assert(
+    [] {
+        SmallHistogram h;
+        h.record_ns(42);
+        h.reset();
+        return h.count() == 0 && h.percentile(50.0).get() == 0 && h.max().get() == 0;
+    }(),
+    "reset empties the histogram");
+
+// NOLINTEND(readability-magic-numbers,readability-identifier-length)
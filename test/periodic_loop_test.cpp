@@ -0,0 +1,150 @@
+// NOLINTBEGIN(readability-magic-numbers) — test file
+#include <doctest/doctest.h>
+
+#include "strong-types/periodic_loop.hpp"
+#include "strong-types/si_literals.hpp"
+#include "strong-types/si_scaled_literals.hpp"
+
+#include <cstdint>
+#include <thread>
+
+using namespace strong_types;
+using namespace strong_types::si_literals;
+using namespace strong_types::si_scaled_literals;
+
+// ---- clock helpers ----
+
+static_assert(time_since_origin(SteadyTimePoint<double>{1.5}).get() == 1'500'000'000, "point → ns since origin");
+static_assert(to_steady_point(Nanoseconds<std::int64_t>{std::int64_t{250'000'000}}).get() == 0.25,
+              "ns since origin → point");
+
+TEST_CASE("steady_now is monotonic and matches steady_clock")
+{
+    const auto a = steady_now_ns();
+    const auto b = steady_now_ns();
+    CHECK(b.get() >= a.get());
+
+    const auto chrono_now = from_time_point(std::chrono::steady_clock::now());
+    CHECK(chrono_now.get() >= to_steady_point(b).get());
+}
+
+TEST_CASE("sleep_until wakes no earlier than the deadline")
+{
+    const auto deadline = steady_now() + 2.0_ms;
+    sleep_until(deadline);
+    CHECK(steady_now() >= deadline);
+}
+
+// ---- LatenessHistogram ----
+
+TEST_CASE("LatenessHistogram buckets by power of two")
+{
+    LatenessHistogram hist;
+    hist.record(Nanoseconds<std::int64_t>{std::int64_t{-5}});
+    hist.record(Nanoseconds<std::int64_t>{std::int64_t{0}});
+    hist.record(Nanoseconds<std::int64_t>{std::int64_t{1}});
+    hist.record(Nanoseconds<std::int64_t>{std::int64_t{3}});
+    hist.record(Nanoseconds<std::int64_t>{std::int64_t{1000}});
+
+    CHECK(hist.count() == 5);
+    CHECK(hist.bucket(0) == 2);  // on time
+    CHECK(hist.bucket(1) == 1);  // [1, 2)
+    CHECK(hist.bucket(2) == 1);  // [2, 4)
+    CHECK(hist.bucket(10) == 1); // [512, 1024)
+    CHECK(hist.max().get() == 1000);
+    CHECK(hist.percentile(40.0).get() == 0);
+    CHECK(hist.percentile(100.0).get() == 1023);
+    CHECK(hist.percentile(250.0).get() == 1023); // clamped to 100
+
+    hist.reset();
+    CHECK(hist.count() == 0);
+    CHECK(hist.max().get() == 0);
+}
+
+// ---- PeriodicLoop ----
+
+TEST_CASE("PeriodicLoop period from typed rate or duration")
+{
+    CHECK(PeriodicLoop{1000.0_Hz}.period().get() == 1'000'000);
+    CHECK(PeriodicLoop{250.0_Hz}.period().get() == 4'000'000);
+    CHECK(PeriodicLoop{Milliseconds<std::int64_t>{std::int64_t{2}}}.period().get() == 2'000'000);
+    CHECK(PeriodicLoop{500.0_us}.period().get() == 500'000);
+}
+
+TEST_CASE("PeriodicLoop rejects non-positive rates and periods")
+{
+    CHECK(period_from_rate(0.0_Hz).error() == PeriodErrc::not_positive);
+    CHECK(period_from_rate(-5.0_Hz).error() == PeriodErrc::not_positive);
+    CHECK(period_from_rate(1e-12_Hz).error() == PeriodErrc::out_of_range);
+    CHECK(period_from_rate(1e12_Hz)->get() == 1);
+
+    CHECK(PeriodicLoop::create(0.0_Hz).error() == PeriodErrc::not_positive);
+    CHECK(PeriodicLoop::create(Milliseconds<std::int64_t>{std::int64_t{0}}).error() == PeriodErrc::not_positive);
+    const auto loop = PeriodicLoop::create(500.0_Hz);
+    REQUIRE(loop);
+    CHECK(loop->period().get() == 2'000'000);
+
+    // The constructors clamp instead, so wait_next() never divides by zero
+    CHECK(PeriodicLoop{0.0_Hz}.period().get() == 1);
+    CHECK(PeriodicLoop{Nanoseconds<std::int64_t>{std::int64_t{-3}}}.period().get() == 1);
+}
+
+TEST_CASE("PeriodicLoop runs on absolute deadlines until the body stops it")
+{
+    PeriodicLoop loop{1000.0_Hz, 50.0_us};
+    int calls = 0;
+    const auto begin = steady_now_ns();
+    loop.run([&] { return ++calls < 20; });
+    const auto elapsed = steady_now_ns().get() - begin.get();
+
+    CHECK(calls == 20);
+    CHECK(loop.iterations() == 20);
+    CHECK(loop.lateness().count() == 20);
+    CHECK(elapsed >= 20'000'000); // 20 periods, none may fire early
+}
+
+TEST_CASE("PeriodicLoop counts overruns and keeps its phase")
+{
+    PeriodicLoop loop{Milliseconds<std::int64_t>{std::int64_t{1}}};
+    loop.start();
+    const auto first = loop.next_deadline();
+
+    loop.wait_next();
+    std::this_thread::sleep_for(std::chrono::milliseconds(3)); // body overruns by several periods
+    loop.wait_next();
+
+    CHECK(loop.overruns() == 1);
+    CHECK(loop.iterations() == 2);
+    const auto phase = time_since_origin(loop.next_deadline()).get() - time_since_origin(first).get();
+    CHECK(phase % 1'000'000 == 0);
+}
+
+TEST_CASE("PeriodicLoop stop() from another thread")
+{
+    PeriodicLoop loop{1000.0_Hz};
+    std::thread stopper{[&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        loop.stop();
+    }};
+    loop.run([] {});
+    stopper.join();
+    CHECK(loop.iterations() > 0);
+}
+
+TEST_CASE("PeriodicLoop stop() before run() is not lost")
+{
+    PeriodicLoop loop{1000.0_Hz};
+    loop.stop();
+    int calls = 0;
+    loop.run([&] { ++calls; });
+    CHECK(calls == 0);
+    CHECK(loop.iterations() == 0);
+    CHECK(loop.stop_requested());
+
+    loop.clear_stop();
+    CHECK_FALSE(loop.stop_requested());
+    loop.run([&] { return ++calls < 3; });
+    CHECK(calls == 3);
+}
+
+// NOLINTEND(readability-magic-numbers)
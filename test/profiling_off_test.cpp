@@ -0,0 +1,49 @@
+// NOLINTBEGIN(readability-magic-numbers) — test file
+#include <doctest/doctest.h>
+
+#include "strong-types/profiling.hpp"
+
+#include <string>
+#include <type_traits>
+
+using namespace strong_types;
+
+static_assert(STRONG_TYPES_PROFILING == 0, "this test is built with profiling disabled");
+
+#ifdef FMT_VERSION
+#error "profiling.hpp must not include {fmt} when profiling is disabled"
+#endif
+
+static_assert(std::is_empty_v<profiling::ScopedTimer>, "a disabled timer has no state");
+static_assert(std::is_trivially_destructible_v<profiling::ScopedTimer>, "a disabled timer has no destructor");
+static_assert(
+    []
+    {
+        constexpr profiling::CallSite site{"constexpr", "file", 1};
+        const profiling::ScopedTimer timer{site};
+        return timer.elapsed().get() == 0;
+    }(),
+    "a disabled timer is usable in constant expressions");
+
+namespace
+{
+
+int profiled_work(int x)
+{
+    STRONG_TYPES_PROFILE_SCOPE("profiled_work");
+    return x * 2;
+}
+
+} // namespace
+
+TEST_CASE("disabled profiling records nothing and reports empty")
+{
+    CHECK(profiled_work(21) == 42);
+    profiling::reset();
+    CHECK(profiling::collect_stats().empty());
+    CHECK(profiling::format_summary().empty());
+    CHECK(profiling::chrome_trace_json().find(R"("traceEvents":[)") != std::string::npos);
+    CHECK(profiling::write_chrome_trace("/nonexistent-dir/trace.json").error() == profiling::TraceErrc::open_failed);
+}
+
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,157 @@
+// NOLINTBEGIN(readability-magic-numbers) — test file
+#include <doctest/doctest.h>
+
+#include "strong-types/profiling.hpp"
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+
+using namespace strong_types;
+
+static_assert(STRONG_TYPES_PROFILING == 1, "this test is built with profiling enabled");
+
+namespace
+{
+
+void inner_work()
+{
+    STRONG_TYPES_PROFILE_SCOPE("inner_work");
+    std::this_thread::sleep_for(std::chrono::microseconds(200));
+}
+
+void outer_work()
+{
+    STRONG_TYPES_PROFILE_SCOPE("outer_work");
+    inner_work();
+    inner_work();
+}
+
+const profiling::CallSiteStats *find_site(const std::vector<profiling::CallSiteStats> &stats, std::string_view name)
+{
+    for (const auto &s : stats)
+    {
+        if (s.site->name == name)
+        {
+            return &s;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace
+
+TEST_CASE("scoped timers aggregate per call site")
+{
+    profiling::reset();
+    outer_work();
+    outer_work();
+
+    const auto stats = profiling::collect_stats();
+    const auto *outer = find_site(stats, "outer_work");
+    const auto *inner = find_site(stats, "inner_work");
+    REQUIRE(outer != nullptr);
+    REQUIRE(inner != nullptr);
+    CHECK(outer->count == 2);
+    CHECK(inner->count == 4);
+    CHECK(inner->min >= Nanoseconds<std::int64_t>{std::int64_t{200'000}});
+    CHECK(outer->total >= inner->total);
+    CHECK(stats.front().site == outer->site); // sorted by total time
+}
+
+TEST_CASE("ScopedTimer::elapsed is a typed duration")
+{
+    static constexpr profiling::CallSite site{"elapsed", __FILE__, __LINE__};
+    const profiling::ScopedTimer timer{site};
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+    CHECK(timer.elapsed() >= Nanoseconds<std::int64_t>{std::int64_t{100'000}});
+}
+
+TEST_CASE("threads record into their own buffers")
+{
+    profiling::reset();
+    std::thread a{[] {
+        for (int i = 0; i < 10; ++i)
+        {
+            STRONG_TYPES_PROFILE_SCOPE("threaded");
+        }
+    }};
+    std::thread b{[] {
+        for (int i = 0; i < 5; ++i)
+        {
+            STRONG_TYPES_PROFILE_SCOPE("threaded");
+        }
+    }};
+    a.join();
+    b.join();
+
+    const auto stats = profiling::collect_stats();
+    // each lambda is its own call site; the sum covers both threads
+    std::uint64_t total = 0;
+    for (const auto &s : stats)
+    {
+        if (s.site->name == "threaded")
+        {
+            total += s.count;
+        }
+    }
+    CHECK(total == 15);
+}
+
+TEST_CASE("exited threads hand their buffers to new threads")
+{
+    profiling::reset();
+    std::thread{[] { STRONG_TYPES_PROFILE_SCOPE("recycled"); }}.join();
+    const auto buffers = profiling::Registry::instance().buffer_count();
+    for (int i = 0; i < 20; ++i)
+    {
+        std::thread{[] { STRONG_TYPES_PROFILE_SCOPE("recycled"); }}.join();
+    }
+    CHECK(profiling::Registry::instance().buffer_count() == buffers);
+
+    std::uint64_t recorded = 0;
+    for (const auto &s : profiling::collect_stats())
+    {
+        if (s.site->name == "recycled")
+        {
+            recorded += s.count;
+        }
+    }
+    CHECK(recorded == 21); // exited threads' events are kept
+}
+
+TEST_CASE("summary uses typed duration formatting")
+{
+    profiling::reset();
+    outer_work();
+    const auto summary = profiling::format_summary();
+    CHECK(summary.find("outer_work") != std::string::npos);
+    CHECK(summary.find(" ms") != std::string::npos);
+    CHECK(summary.find(" us") != std::string::npos);
+    CHECK(summary.find(" ns") != std::string::npos);
+}
+
+TEST_CASE("Chrome trace JSON export")
+{
+    profiling::reset();
+    outer_work();
+
+    const auto json = profiling::chrome_trace_json();
+    CHECK(json.find(R"("traceEvents":[)") != std::string::npos);
+    CHECK(json.find(R"("name":"outer_work")") != std::string::npos);
+    CHECK(json.find(R"("ph":"X")") != std::string::npos);
+
+    const auto path = std::filesystem::temp_directory_path() / "strong_types_trace_test.json";
+    REQUIRE(profiling::write_chrome_trace(path.c_str()).has_value());
+    std::ifstream in{path};
+    const std::string written{std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{}};
+    CHECK(written == json);
+    std::filesystem::remove(path);
+
+    CHECK(profiling::write_chrome_trace("/nonexistent-dir/trace.json").error() == profiling::TraceErrc::open_failed);
+}
+
+// NOLINTEND(readability-magic-numbers)
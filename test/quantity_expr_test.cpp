@@ -0,0 +1,91 @@
+#include "strong-types/quantity_expr.hpp"
+#include "strong-types/si_literals.hpp"
+#include "strong-types/si_scaled_literals.hpp"
+
+#include <cstdint>
+#include <ratio>
+#include <type_traits>
+
+using namespace strong_types;
+using namespace strong_types::si_literals;
+using namespace strong_types::si_scaled_literals;
+
+template <typename T>
+using Meters = ScaledUnit<T, LengthTag, std::ratio<1>>;
+
+// ---- common_ratio_t ----
+
+static_assert(std::is_same_v<common_ratio_t<std::kilo, std::ratio<1>, std::centi>, std::centi>, "km, m, cm → cm");
+static_assert(std::is_same_v<common_ratio_t<std::ratio<60>, std::ratio<3600>>, std::ratio<60>>, "min, hr → min");
+static_assert(std::is_same_v<common_ratio_t<std::ratio<3, 2>, std::ratio<5, 3>>, std::ratio<1, 6>>, "3/2, 5/3 → 1/6");
+static_assert(std::is_same_v<common_ratio_t<std::ratio<-1000>>, std::kilo>, "sign is dropped");
+
+// ---- the expression records operands and their ratios ----
+
+using Mixed = decltype(lazy(5.0_km) + 300.0_m - 20.0_cm);
+static_assert(std::is_same_v<Mixed, QuantityExpr<double, LengthTag, std::kilo, std::ratio<1>, std::ratio<-1, 100>>>,
+              "subtraction negates the ratio, not the value");
+static_assert(is_quantity_expr_v<Mixed> && !is_quantity_expr_v<Kilometers<double>>, "detector");
+static_assert(std::is_same_v<Mixed::common_ratio_type, std::centi>, "summed at cm");
+
+// ---- floating point: one pre-folded factor per term ----
+
+static_assert([]
+              {
+    constexpr unit_t<double, LengthTag> m = lazy(5.0_km) + 300.0_m - 20.0_cm;
+    return m.get() == 5299.8; }(), "5 km + 300 m - 20 cm = 5299.8 m");
+
+static_assert([]
+              {
+    constexpr Centimeters<double> cm = lazy(1.0_km) - 1.0_m;
+    return cm.get() == 99900.0; }(), "materializes at the assignment target");
+
+static_assert((lazy(2.0_hr) + 30.0_min).as<Minutes<double>>().get() == 150.0, "as<Target>()");
+static_assert((lazy(1.0_s) + 500.0_ms).in<std::milli>().get() == 1500.0, "in<Ratio>()");
+static_assert((300.0_m + lazy(1.0_km)).to_base().get() == 1300.0, "expression on the right");
+static_assert((-(lazy(1.0_km) - 200.0_m)).to_base().get() == -800.0, "unary minus");
+
+static_assert([]
+              {
+    constexpr auto a = lazy(1.0_km) + 1.0_m;
+    constexpr auto b = lazy(10.0_cm) + 5.0_mm;
+    constexpr Millimeters<double> mm = a - b;
+    return mm.get() == 1000895.0; }(), "expression ± expression");
+
+// ---- integral: exact at the common ratio, rounded once into the target ----
+
+static_assert([]
+              {
+    constexpr Kilometers<std::int64_t> km{std::int64_t{5}};
+    constexpr Meters<std::int64_t> m{std::int64_t{300}};
+    constexpr Centimeters<std::int64_t> cm{std::int64_t{20}};
+    constexpr auto expr = lazy(km) + m - cm;
+    constexpr Centimeters<std::int64_t> exact = expr;
+    return exact.get() == 529980 && expr.eval().get() == 529980; }(), "no per-term truncation");
+
+static_assert([]
+              {
+    constexpr Centimeters<int> a{150};
+    constexpr Centimeters<int> b{70};
+    constexpr Millimeters<int> c{5};
+    // eager to_base() truncates 1.5 m, 0.7 m and 0.005 m separately: 1 + 0 + 0 = 1
+    constexpr Meters<int> m = lazy(a) + b + c;
+    return m.get() == 2; }(), "one rounding step: 2.205 m → 2 m");
+
+static_assert([]
+              {
+    constexpr Hours<std::int64_t> h{std::int64_t{1}};
+    constexpr Minutes<std::int64_t> mins{std::int64_t{1}};
+    constexpr Milliseconds<std::int64_t> ms = lazy(h) - mins;
+    return ms.get() == 3'540'000; }(), "hr - min in ms");
+
+// ---- integral: conversion factors that do not fit T are rejected instead of truncated ----
+
+using HourMinusNs = decltype(lazy(Hours<std::int32_t>{std::int32_t{1}}) - Nanoseconds<std::int32_t>{std::int32_t{1}});
+static_assert(!HourMinusNs::representable_in<std::nano>, "3.6e12 ns per hour does not fit int32");
+using NsSum = decltype(lazy(Nanoseconds<std::int32_t>{std::int32_t{1}}) + Microseconds<std::int32_t>{std::int32_t{1}});
+static_assert(NsSum::representable_in<std::milli> && !NsSum::representable_in<std::ratio<3600>>,
+              "rounding into hours divides by 3.6e12");
+static_assert(
+    QuantityExpr<std::int64_t, TimeTag, std::ratio<3600>, std::ratio<-1, 1'000'000'000>>::representable_in<std::nano>);
+static_assert(QuantityExpr<double, TimeTag, std::ratio<3600>, std::nano>::representable_in<std::ratio<1>>);
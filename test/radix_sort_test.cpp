@@ -0,0 +1,176 @@
+// NOLINTBEGIN(readability-magic-numbers) — test file
+#include <doctest/doctest.h>
+
+#include "strong-types/quantity_point.hpp"
+#include "strong-types/radix_sort.hpp"
+#include "strong-types/si.hpp"
+#include "strong-types/si_scaled.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace strong_types;
+
+namespace
+{
+
+using Ns = Nanoseconds<std::int64_t>;
+using Range = unit_t<float, LengthTag>;
+using Stamp = QuantityPoint<std::uint32_t, TimeTag>;
+
+template <typename Q>
+constexpr bool key_less(Q lhs, Q rhs)
+{
+    return detail::radix_key(lhs) < detail::radix_key(rhs);
+}
+
+std::vector<Ns> random_stamps(std::size_t count, std::uint64_t seed)
+{
+    std::mt19937_64 rng{seed};
+    std::uniform_int_distribution<std::int64_t> dist{-5'000'000'000, 5'000'000'000};
+    std::vector<Ns> stamps;
+    stamps.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        stamps.emplace_back(dist(rng));
+    }
+    return stamps;
+}
+
+/// Payload whose move assignment throws on one chosen thread
+struct ThrowingPayload
+{
+    static inline std::thread::id armed{};
+
+    std::uint32_t value = 0;
+
+    ThrowingPayload() = default;
+    ThrowingPayload(const ThrowingPayload &) = default;
+    ThrowingPayload(ThrowingPayload &&) = default;
+    ~ThrowingPayload() = default;
+    ThrowingPayload &operator=(const ThrowingPayload &) = default;
+
+    ThrowingPayload &operator=(ThrowingPayload &&other)
+    {
+        if (std::this_thread::get_id() == armed)
+        {
+            throw std::runtime_error("payload move");
+        }
+        value = other.value;
+        return *this;
+    }
+};
+
+} // namespace
+
+// ---- key mapping keeps the value order ----
+
+static_assert(RadixSortable<Ns> && RadixSortable<Range> && RadixSortable<Stamp> && RadixSortable<Millimeters<double>>);
+static_assert(!RadixSortable<double> && !RadixSortable<Strong<bool, LengthTag>>);
+static_assert(key_less(Ns{std::int64_t{-1}}, Ns{std::int64_t{0}}) &&
+              key_less(Ns{std::int64_t{0}}, Ns{std::int64_t{1}}));
+static_assert(key_less(Range{-2.0F}, Range{-1.0F}) && key_less(Range{-1.0F}, Range{-0.0F}) &&
+              key_less(Range{-0.0F}, Range{0.0F}) && key_less(Range{0.0F}, Range{1.5F}));
+static_assert(key_less(Range{-std::numeric_limits<float>::infinity()}, Range{-1e30F}) &&
+              key_less(Range{1e30F}, Range{std::numeric_limits<float>::infinity()}));
+
+// ---- serial ----
+
+TEST_CASE("radix_sort matches std::sort for signed timestamps")
+{
+    auto stamps = random_stamps(10'000, 1);
+    auto expected = stamps;
+    std::sort(expected.begin(), expected.end());
+    radix_sort(stamps);
+    CHECK(stamps == expected);
+}
+
+TEST_CASE("radix_sort orders floats across the sign bit")
+{
+    std::vector<Range> ranges{Range{3.5F},  Range{-0.5F}, Range{0.0F},
+                              Range{-7.0F}, Range{1e-30F}, Range{-std::numeric_limits<float>::infinity()},
+                              Range{2.0F},  Range{-1e-30F}};
+    auto expected = ranges;
+    std::sort(expected.begin(), expected.end());
+    radix_sort(ranges);
+    CHECK(ranges == expected);
+}
+
+TEST_CASE("radix_sort handles scaled units, points and trivial inputs")
+{
+    std::vector<Millimeters<double>> mm{Millimeters<double>{2.0}, Millimeters<double>{-3.0}, Millimeters<double>{1.0}};
+    radix_sort(mm);
+    CHECK(mm.front() == Millimeters<double>{-3.0});
+    CHECK(mm.back() == Millimeters<double>{2.0});
+
+    std::vector<Stamp> points{Stamp{7U}, Stamp{3U}, Stamp{0xFFFF'FFFFU}, Stamp{3U}};
+    radix_sort(points);
+    CHECK(points == std::vector<Stamp>{Stamp{3U}, Stamp{3U}, Stamp{7U}, Stamp{0xFFFF'FFFFU}});
+
+    std::vector<Ns> none;
+    radix_sort(none);
+    std::vector<Ns> same(5, Ns{std::int64_t{42}});
+    radix_sort(same);
+    CHECK(same == std::vector<Ns>(5, Ns{std::int64_t{42}}));
+}
+
+TEST_CASE("radix_sort_by_key is stable and moves the payload")
+{
+    std::vector<Range> keys{Range{2.0F}, Range{1.0F}, Range{2.0F}, Range{-1.0F}, Range{1.0F}};
+    std::vector<std::string> names{"a", "b", "c", "d", "e"};
+    REQUIRE(radix_sort_by_key(keys, names));
+    CHECK(names == std::vector<std::string>{"d", "b", "e", "a", "c"});
+    CHECK(keys.front() == Range{-1.0F});
+
+    std::vector<int> short_payload(2);
+    const auto bad = radix_sort_by_key(keys, short_payload);
+    REQUIRE_FALSE(bad);
+    CHECK(bad.error() == SortErrc::size_mismatch);
+}
+
+// ---- parallel ----
+
+TEST_CASE("parallel_radix_sort matches the serial sort")
+{
+    const std::size_t count = PARALLEL_RADIX_MIN_PER_THREAD * 4 + 17;
+    auto stamps = random_stamps(count, 2);
+    auto expected = stamps;
+    std::sort(expected.begin(), expected.end());
+    parallel_radix_sort(stamps, 4);
+    CHECK(stamps == expected);
+
+    std::vector<Ns> keys = random_stamps(count, 3);
+    std::vector<std::uint32_t> order(count);
+    for (std::uint32_t i = 0; i < count; ++i)
+    {
+        order[i] = i;
+    }
+    auto original = keys;
+    REQUIRE(parallel_radix_sort_by_key(keys, order, 3));
+    bool consistent = std::is_sorted(keys.begin(), keys.end());
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        consistent = consistent && original[order[i]] == keys[i];
+        consistent = consistent && (i == 0 || keys[i - 1] != keys[i] || order[i - 1] < order[i]); // stable
+    }
+    CHECK(consistent);
+}
+
+TEST_CASE("parallel_radix_sort_by_key joins its workers when a payload move throws")
+{
+    const std::size_t count = PARALLEL_RADIX_MIN_PER_THREAD * 2;
+    std::vector<Ns> keys = random_stamps(count, 4);
+    std::vector<ThrowingPayload> payload(count);
+    ThrowingPayload::armed = std::this_thread::get_id();
+    CHECK_THROWS_AS(parallel_radix_sort_by_key(keys, payload, 2), std::runtime_error);
+    ThrowingPayload::armed = std::thread::id{};
+}
+
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,203 @@
+// NOLINTBEGIN(readability-magic-numbers) — test file
+#include <doctest/doctest.h>
+
+#include "strong-types/rate_limiter.hpp"
+#include "strong-types/si_literals.hpp"
+#include "strong-types/si_scaled_literals.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <vector>
+
+using namespace strong_types;
+using namespace strong_types::si_literals;
+using namespace strong_types::si_scaled_literals;
+
+namespace
+{
+
+constexpr Nanoseconds<std::int64_t> at_ms(std::int64_t ms)
+{
+    return Nanoseconds<std::int64_t>{ms * 1'000'000};
+}
+
+} // namespace
+
+// ---- TokenBucket ----
+
+TEST_CASE("TokenBucket admits a burst then one token per interval")
+{
+    TokenBucket bucket{100.0_Hz, 3}; // 10 ms per token
+    CHECK(bucket.interval().get() == 10'000'000);
+    CHECK(bucket.available(at_ms(1000)) == 3);
+
+    CHECK(bucket.try_acquire(at_ms(1000)));
+    CHECK(bucket.try_acquire(at_ms(1000)));
+    CHECK(bucket.try_acquire(at_ms(1000)));
+    CHECK_FALSE(bucket.try_acquire(at_ms(1000)));
+    CHECK(bucket.available(at_ms(1000)) == 0);
+    CHECK(bucket.retry_after(at_ms(1000)).get() == 10'000'000);
+
+    CHECK_FALSE(bucket.try_acquire(at_ms(1009)));
+    CHECK(bucket.try_acquire(at_ms(1010)));
+    CHECK(bucket.available(at_ms(1040)) == 3); // refills up to the burst, no further
+}
+
+TEST_CASE("TokenBucket multi-token requests and typed intervals")
+{
+    TokenBucket bucket{Milliseconds<std::int64_t>{std::int64_t{5}}, 4};
+    CHECK(bucket.try_acquire(at_ms(0), 4));
+    CHECK_FALSE(bucket.try_acquire(at_ms(0), 1));
+    CHECK(bucket.retry_after(at_ms(0), 2).get() == 10'000'000);
+    CHECK(bucket.try_acquire(at_ms(10), 2));
+    CHECK_FALSE(bucket.try_acquire(at_ms(100), 5)); // larger than the burst never fits
+
+    bucket.reset();
+    CHECK(bucket.available(at_ms(0)) == 4);
+}
+
+TEST_CASE("TokenBucket accepts steady-clock points and reads the clock itself")
+{
+    TokenBucket bucket{1.0_Hz};
+    const auto now = steady_now();
+    CHECK(bucket.try_acquire(now));
+    CHECK_FALSE(bucket.try_acquire(now + 0.5_s));
+    CHECK(bucket.try_acquire(now + 1.0_s));
+
+    TokenBucket fresh{1000.0_Hz};
+    CHECK(fresh.try_acquire());
+}
+
+TEST_CASE("ConcurrentTokenBucket admits exactly the burst under contention")
+{
+    ConcurrentTokenBucket bucket{1.0_Hz, 1000};
+    const auto now = at_ms(5000);
+    std::atomic<int> admitted{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&] {
+            for (int i = 0; i < 1000; ++i)
+            {
+                if (bucket.try_acquire(now))
+                {
+                    admitted.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+    for (auto &th : threads)
+    {
+        th.join();
+    }
+    CHECK(admitted.load() == 1000);
+}
+
+// ---- LeakyBucket ----
+
+TEST_CASE("LeakyBucket spaces requests and rejects past the queue depth")
+{
+    LeakyBucket shaper{100.0_Hz, 25.0_ms}; // 10 ms spacing, up to 25 ms of queue
+    const auto d0 = shaper.reserve(at_ms(0));
+    const auto d1 = shaper.reserve(at_ms(0));
+    const auto d2 = shaper.reserve(at_ms(0));
+    REQUIRE(d0.has_value());
+    REQUIRE(d1.has_value());
+    REQUIRE(d2.has_value());
+    CHECK(d0->get() == 0);
+    CHECK(d1->get() == 10'000'000);
+    CHECK(d2->get() == 20'000'000);
+    CHECK_FALSE(shaper.reserve(at_ms(0)).has_value());
+    CHECK(shaper.backlog(at_ms(0)).get() == 30'000'000);
+
+    const auto later = shaper.reserve(at_ms(40));
+    REQUIRE(later.has_value());
+    CHECK(later->get() == 0);
+}
+
+TEST_CASE("ConcurrentLeakyBucket hands out distinct slots")
+{
+    ConcurrentLeakyBucket shaper{Microseconds<std::int64_t>{std::int64_t{1}}, 1.0_s};
+    std::vector<std::vector<std::int64_t>> delays(4);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < delays.size(); ++t)
+    {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < 500; ++i)
+            {
+                delays[t].push_back(shaper.reserve(at_ms(0))->get());
+            }
+        });
+    }
+    for (auto &th : threads)
+    {
+        th.join();
+    }
+    std::vector<std::int64_t> all;
+    for (const auto &d : delays)
+    {
+        all.insert(all.end(), d.begin(), d.end());
+    }
+    std::sort(all.begin(), all.end());
+    for (std::size_t i = 0; i < all.size(); ++i)
+    {
+        CHECK(all[i] == static_cast<std::int64_t>(i) * 1000);
+    }
+}
+
+TEST_CASE("rate limiters share period_from_rate and create() rejects non-positive rates")
+{
+    CHECK(TokenBucket{100.0_Hz}.interval() == period_from_rate(100.0_Hz).value());
+    CHECK(LeakyBucket(3.0_Hz, 1.0_s).interval().get() == 333'333'333);
+
+    // The constructors clamp instead of dividing by zero or going negative
+    CHECK(TokenBucket{0.0_Hz}.interval().get() == 1);
+    CHECK(LeakyBucket(-5.0_Hz, 1.0_s).interval().get() == 1);
+
+    CHECK(TokenBucket::create(0.0_Hz).error() == PeriodErrc::not_positive);
+    CHECK(ConcurrentTokenBucket::create(-1.0_Hz, 4).error() == PeriodErrc::not_positive);
+    CHECK(LeakyBucket::create(0.0_Hz, 1.0_s).error() == PeriodErrc::not_positive);
+    CHECK(ConcurrentLeakyBucket::create(1e-12_Hz, 1.0_s).error() == PeriodErrc::out_of_range);
+    CHECK(TokenBucket::create(Milliseconds<std::int64_t>{std::int64_t{0}}).error() == PeriodErrc::not_positive);
+    CHECK(LeakyBucket::create(Milliseconds<std::int64_t>{std::int64_t{-1}}, 1.0_s).error() ==
+          PeriodErrc::not_positive);
+
+    const auto bucket = ConcurrentTokenBucket::create(50.0_Hz, 3);
+    REQUIRE(bucket.has_value());
+    CHECK(bucket->interval().get() == 20'000'000);
+    CHECK(bucket->burst() == 3);
+    const auto shaper = LeakyBucket::create(Milliseconds<std::int64_t>{std::int64_t{2}}, 1.0_s);
+    REQUIRE(shaper.has_value());
+    CHECK(shaper->interval().get() == 2'000'000);
+}
+
+TEST_CASE("rate limiters bound their int64 nanosecond arithmetic")
+{
+    constexpr auto max_ns = std::numeric_limits<std::int64_t>::max();
+    const Days<std::int64_t> century{std::int64_t{36'525}}; // ~3.2e18 ns
+
+    // burst * interval must fit: create() rejects it, the constructor clamps the interval
+    CHECK(TokenBucket::create(century, 3).error() == PeriodErrc::out_of_range);
+    CHECK(TokenBucket::create(1e-9_Hz, 10).error() == PeriodErrc::out_of_range);
+    CHECK(TokenBucket::create(century, 2).has_value());
+    const TokenBucket clamped{century, 3};
+    CHECK(clamped.interval().get() == max_ns / 3);
+    CHECK(clamped.available(at_ms(0)) == 3);
+
+    // More tokens than the burst never fit, whatever the multiply would have produced
+    TokenBucket bucket{Days<std::int64_t>{std::int64_t{10'000}}, 4}; // ~8.6e17 ns per token
+    CHECK_FALSE(bucket.try_acquire(at_ms(0), 4'000'000'000U));
+    CHECK(bucket.retry_after(at_ms(0), 4'000'000'000U).get() == max_ns);
+    CHECK(bucket.try_acquire(at_ms(0), 4));
+
+    // The shaper saturates its queue at int64 max instead of wrapping negative
+    LeakyBucket shaper{century, 1.0_s};
+    REQUIRE(shaper.reserve(at_ms(0), 4'000'000'000U).has_value());
+    CHECK(shaper.backlog(at_ms(0)).get() == max_ns);
+    CHECK_FALSE(shaper.reserve(at_ms(0)).has_value());
+}
+
+// NOLINTEND(readability-magic-numbers)
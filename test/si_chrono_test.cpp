@@ -4,6 +4,7 @@
 #include "strong-types/si_scaled_literals.hpp"
 
 #include <chrono>
+#include <cstdint>
 
 using namespace strong_types;
 using namespace strong_types::si_literals;
@@ -118,6 +119,21 @@ static_assert(
     }(),
     "round-trip timespec→strong→timespec");
 
+// ---- to_nanoseconds: exact integer path ----
+
+static_assert(to_nanoseconds(Milliseconds<std::int64_t>{std::int64_t{3}}).get() == 3'000'000, "3ms → 3000000ns");
+static_assert(to_nanoseconds(Nanoseconds<std::int64_t>{std::int64_t{-7}}).get() == -7, "ns passthrough");
+static_assert(to_nanoseconds(unit_t<int, TimeTag>{2}).get() == 2'000'000'000, "2s (int) → ns");
+static_assert(std::is_same_v<decltype(to_nanoseconds(1.0_s)), Nanoseconds<std::int64_t>>, "result is int64 ns");
+
+// ---- to_nanoseconds: floating-point path rounds to nearest ----
+
+static_assert(to_nanoseconds(1.5_s).get() == 1'500'000'000, "1.5s → ns");
+static_assert(to_nanoseconds(250.0_ms).get() == 250'000'000, "250ms → ns");
+static_assert(to_nanoseconds(0.4_ns).get() == 0, "0.4ns rounds down");
+static_assert(to_nanoseconds(0.6_ns).get() == 1, "0.6ns rounds up");
+static_assert(to_nanoseconds(-0.6_ns).get() == -1, "-0.6ns rounds away from zero");
+
 // ---- timeval tests (POSIX only) ----
 
 #if STRONG_TYPES_HAS_TIMEVAL
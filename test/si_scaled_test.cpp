@@ -3,6 +3,10 @@
 #include "strong-types/si_scaled.hpp"
 #include "strong-types/si_scaled_literals.hpp"
 
+#include <cstdint>
+#include <ratio>
+#include <type_traits>
+
 using namespace strong_types;
 using namespace strong_types::si_scaled_literals;
 using namespace strong_types::si_literals;
@@ -76,14 +80,50 @@ static_assert(
     }(),
     "2km - 500m = 1500m");
 
-// ---- cross-scale same-tag (different ratios → base) ----
+// ---- cross-scale same-tag (different ratios → common ratio) ----
 
 static_assert(
     [] {
         constexpr auto result = 1.0_km + 50000.0_cm;
-        return result.get() == 1500.0;
+        static_assert(std::is_same_v<std::remove_cvref_t<decltype(result)>, Centimeters<double>>);
+        return result.get() == 150000.0 && result.to_base().get() == 1500.0;
+    }(),
+    "1km + 50000cm = 150000cm");
+
+static_assert(
+    [] {
+        constexpr auto result = 2.0_hr - 30.0_min;
+        static_assert(std::is_same_v<std::remove_cvref_t<decltype(result)>, Minutes<double>>);
+        return result.get() == 90.0;
+    }(),
+    "2hr - 30min = 90min");
+
+static_assert(
+    [] {
+        constexpr Millimeters<std::int32_t> a{std::int32_t{1}};
+        constexpr Micrometers<std::int32_t> b{std::int32_t{500}};
+        constexpr auto sum = a + b;
+        constexpr auto diff = a - b;
+        static_assert(std::is_same_v<std::remove_cvref_t<decltype(sum)>, Micrometers<std::int32_t>>);
+        return sum.get() == 1500 && diff.get() == 500;
+    }(),
+    "integer mm ± um stays exact in um");
+
+// 1 hr = 3.6e12 ns does not fit int32, so the sum is rejected instead of silently truncating the factor
+static_assert(!common_ratio_representable_v<Hours<std::int32_t>, Nanoseconds<std::int32_t>>);
+static_assert(common_ratio_representable_v<Hours<std::int64_t>, Nanoseconds<std::int64_t>>);
+static_assert(common_ratio_representable_v<Millimeters<std::int32_t>, Micrometers<std::int32_t>>);
+static_assert(common_ratio_representable_v<Hours<double>, Nanoseconds<double>>);
+
+static_assert(
+    [] {
+        constexpr ScaledUnit<std::int64_t, LengthTag, std::ratio<3, 2>> a{std::int64_t{2}};
+        constexpr ScaledUnit<std::int64_t, LengthTag, std::ratio<5, 3>> b{std::int64_t{3}};
+        constexpr auto sum = a + b; // 3 m + 5 m in sixths of a metre
+        static_assert(std::is_same_v<std::remove_cvref_t<decltype(sum)>::ratio_type, std::ratio<1, 6>>);
+        return sum.get() == 48;
     }(),
-    "1km + 50000cm = 1500m");
+    "non-decimal ratios meet at gcd(num) / lcm(den)");
 
 // ---- scalar multiply/divide (preserve scale) ----
 
@@ -0,0 +1,83 @@
+// NOLINTBEGIN(readability-magic-numbers) — test file
+
+#include "strong-types/slot_map.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+using namespace strong_types;
+
+namespace
+{
+
+struct BodyTag;
+struct JointTag;
+using Bodies = SlotMap<int, BodyTag>;
+
+} // namespace
+
+// ---- handles ----
+
+static_assert(std::is_trivially_copyable_v<Bodies::handle_type>);
+static_assert(!std::is_convertible_v<SlotHandle<BodyTag>, SlotHandle<JointTag>>);
+static_assert(!std::is_constructible_v<SlotHandle<BodyTag>, std::uint64_t>);
+static_assert(!SlotHandle<BodyTag>{}.is_valid());
+static_assert(SlotHandle<BodyTag>::from_bits(SlotHandle<BodyTag>{7, 3}.bits()) == SlotHandle<BodyTag>{7, 3});
+
+// ---- insert / find / erase ----
+
+static_assert([]
+              {
+                  Bodies bodies;
+                  const auto a = bodies.insert(10);
+                  const auto b = bodies.emplace(20);
+                  const auto c = bodies.insert(30);
+                  bodies[b] += 1;
+                  return bodies.size() == 3 && *bodies.find(a) == 10 && bodies[b] == 21 && bodies.contains(c) &&
+                         a.is_valid() && !bodies.contains(Bodies::handle_type{}) &&
+                         bodies.find(Bodies::handle_type{}) == nullptr;
+              }());
+
+static_assert([]
+              {
+                  // Stale handles never resolve, even after their slot is reused
+                  Bodies bodies;
+                  const auto a = bodies.insert(1);
+                  bodies.insert(2);
+                  const bool erased = bodies.erase(a);
+                  const bool again = bodies.erase(a);
+                  const auto reused = bodies.insert(3);
+                  return erased && !again && reused.index() == a.index() &&
+                         reused.generation() != a.generation() && bodies.find(a) == nullptr &&
+                         bodies[reused] == 3 && bodies.slot_count() == 2;
+              }());
+
+static_assert([]
+              {
+                  // Erase keeps values dense by moving the last element into the hole
+                  Bodies bodies;
+                  const auto a = bodies.insert(1);
+                  const auto b = bodies.insert(2);
+                  const auto c = bodies.insert(3);
+                  bodies.erase(a);
+                  int total = 0;
+                  for (const int value : bodies)
+                  {
+                      total += value;
+                  }
+                  return bodies.values().size() == 2 && bodies.values()[0] == 3 && total == 5 && bodies[b] == 2 &&
+                         bodies[c] == 3 && bodies.handle_at(0) == c;
+              }());
+
+static_assert([]
+              {
+                  Bodies bodies;
+                  const auto a = bodies.insert(1);
+                  const auto b = bodies.insert(2);
+                  bodies.clear();
+                  const auto d = bodies.insert(4);
+                  return bodies.size() == 1 && !bodies.contains(a) && !bodies.contains(b) && bodies[d] == 4 &&
+                         bodies.slot_count() == 2;
+              }());
+
+// NOLINTEND(readability-magic-numbers)
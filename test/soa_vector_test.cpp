@@ -0,0 +1,105 @@
+// NOLINTBEGIN(readability-magic-numbers) — test file
+#include <doctest/doctest.h>
+
+#include "strong-types/soa_vector.hpp"
+
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <tuple>
+#include <type_traits>
+
+using namespace strong_types;
+
+namespace
+{
+
+using Meters = unit_t<double, LengthTag>;
+using Speed = unit_t<double, SpeedTag>;
+using Stamp = Nanoseconds<std::int64_t>;
+using Track = soa_vector<Stamp, Meters, Meters, Speed>;
+
+bool column_aligned(const auto &column)
+{
+    return reinterpret_cast<std::uintptr_t>(column.raw().data()) % SOA_COLUMN_ALIGNMENT == 0; // NOLINT
+}
+
+Track make_track()
+{
+    Track track;
+    for (std::int64_t i = 0; i < 5; ++i)
+    {
+        const auto x = static_cast<double>(i);
+        track.push_back(Stamp{i * 100}, Meters{x}, Meters{-x}, Speed{x * 2.0});
+    }
+    return track;
+}
+
+} // namespace
+
+static_assert(std::random_access_iterator<Track::iterator>);
+static_assert(std::ranges::random_access_range<const Track>);
+static_assert(std::is_same_v<std::tuple_element_t<3, Track::const_reference>, Speed>);
+static_assert(std::is_same_v<std::tuple_element_t<1, Track::reference>, QuantityRef<Meters, double>>);
+
+TEST_CASE("soa_vector stores each field in its own aligned column")
+{
+    Track track = make_track();
+    track.push_back(Track::record{Stamp{std::int64_t{500}}, Meters{5.0}, Meters{-5.0}, Speed{10.0}});
+
+    CHECK(track.size() == 6);
+    CHECK(track.column<0>()[5] == Stamp{std::int64_t{500}});
+    CHECK(track.column<2>()[3] == Meters{-3.0});
+    CHECK(column_aligned(track.column<0>()));
+    CHECK(column_aligned(track.column<1>()));
+    CHECK(column_aligned(track.column<3>()));
+    CHECK(sum(track.column<1>()) == Meters{15.0});
+
+    track.pop_back();
+    CHECK(track.size() == 5);
+    track.resize(7);
+    CHECK(track.column<3>()[6] == Speed{0.0});
+    track.clear();
+    CHECK(track.empty());
+}
+
+TEST_CASE("soa_vector rows are proxies into the columns")
+{
+    Track track = make_track();
+
+    auto [t, x, y, v] = track[2];
+    x = Meters{20.0};
+    v += Speed{1.0};
+    CHECK(t.get() == Stamp{std::int64_t{200}});
+    CHECK(track.column<1>()[2] == Meters{20.0});
+    CHECK(track.column<3>()[2] == Speed{5.0});
+
+    track[4].assign({Stamp{std::int64_t{1}}, Meters{1.0}, Meters{2.0}, Speed{3.0}});
+    const Track::record row = track[4];
+    CHECK(std::get<2>(row) == Meters{2.0});
+
+    double total = 0.0;
+    for (const auto row_ref : std::as_const(track))
+    {
+        total += row_ref.get<2>().get();
+    }
+    CHECK(total == -4.0); // 0 - 1 - 2 - 3 + 2
+}
+
+TEST_CASE("soa_vector column algorithms")
+{
+    Track track = make_track();
+    track.scale<1>(0.5);
+    CHECK(track.column<1>()[4] == Meters{2.0});
+    CHECK(track.column<2>()[4] == Meters{-4.0}); // other columns untouched
+
+    const Track fast = track.filter<3>([](Speed s) { return s > Speed{3.0}; });
+    REQUIRE(fast.size() == 3);
+    CHECK(fast[0].get<0>() == Stamp{std::int64_t{200}});
+    CHECK(fast[2].get<1>() == Meters{2.0});
+    CHECK(fast[2].get<2>() == Meters{-4.0});
+    CHECK(column_aligned(fast.column<2>()));
+    CHECK(track.filter<0>([](Stamp) { return false; }).empty());
+}
+
+// NOLINTEND(readability-magic-numbers)
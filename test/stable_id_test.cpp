@@ -0,0 +1,67 @@
+// NOLINTBEGIN(readability-magic-numbers) — test file
+#include "strong-types/clock.hpp"
+#include "strong-types/si_scaled.hpp"
+#include "strong-types/stable_id.hpp"
+
+#include <cstdint>
+#include <ratio>
+
+namespace app
+{
+struct PixelTag;
+struct GpsEpoch
+{
+};
+} // namespace app
+
+STRONG_TYPES_REGISTER_TAG(app::PixelTag, "px");
+STRONG_TYPES_REGISTER_ORIGIN(app::GpsEpoch, "gps_epoch");
+
+using namespace strong_types;
+
+// ---- pinned values: changing these breaks every stored header ----
+
+static_assert(tag_id_v<LengthTag> == 0x5b77c829a35339d2ULL, "tag ID of \"m\"");
+static_assert(tag_id_v<TimeTag> == 0x5b77da29a3535868ULL, "tag ID of \"s\"");
+static_assert(ratio_id_v<std::milli> == 0xff5fa079724544aeULL, "ratio ID of 1/1000");
+static_assert(quantity_id_v<Kilometers<double>> == 0xb5d4ff11e975830eULL, "quantity ID of km");
+
+// ---- distinctness ----
+
+static_assert(tag_id_v<LengthTag> != tag_id_v<MassTag> && tag_id_v<EnergyTag> != tag_id_v<TorqueTag>, "tags differ");
+static_assert(ratio_id_v<std::milli> != ratio_id_v<std::kilo>, "ratios differ");
+static_assert(ratio_id_v<std::ratio<2, 4>> == ratio_id_v<std::ratio<1, 2>>, "ratios are hashed reduced");
+static_assert(quantity_id_v<Millimeters<double>> != quantity_id_v<Micrometers<double>>, "scale is part of the ID");
+static_assert(quantity_id_v<Millimeters<double>> != quantity_id_v<Milliseconds<double>>, "tag is part of the ID");
+static_assert(quantity_id_v<Kilometers<float>> == quantity_id_v<Kilometers<std::int64_t>>, "value type is not");
+static_assert(quantity_id_v<unit_t<double, LengthTag>> == quantity_id_v<ScaledUnit<float, LengthTag, std::ratio<1>>>,
+              "unit_t is the ratio-1 ScaledUnit");
+static_assert(quantity_id_v<SteadyTimePoint<double>> != quantity_id_v<unit_t<double, TimeTag>>,
+              "a point differs from a displacement");
+
+// ---- registration and fallbacks ----
+
+static_assert(tag_id_v<app::PixelTag> != 0 && tag_id_v<app::PixelTag> != tag_id_v<LengthTag>, "registered tag");
+static_assert(origin_id_v<void> == 0 && origin_id_v<app::GpsEpoch> != origin_id_v<SteadyClockOrigin>,
+              "registered and member-named origins");
+static_assert(quantity_id_v<QuantityPoint<double, TimeTag, app::GpsEpoch>> !=
+                  quantity_id_v<QuantityPoint<double, TimeTag, SteadyClockOrigin>>,
+              "origin is part of the ID");
+static_assert(tag_id_v<dim::Jerk> != tag_id_v<dim::Acceleration>, "unnamed Dimension tags hash their exponents");
+static_assert(tag_id_v<void> != 0, "dimensionless");
+
+// ---- usable as switch labels ----
+
+static_assert([]
+              {
+    constexpr StableId wire = quantity_id_v<Millimeters<float>>;
+    switch (wire)
+    {
+    case quantity_id_v<Millimeters<double>>:
+        return true;
+    case quantity_id_v<Kilometers<double>>:
+    default:
+        return false;
+    } }(), "switch over stable IDs");
+
+// NOLINTEND(readability-magic-numbers)
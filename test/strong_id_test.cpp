@@ -0,0 +1,107 @@
+// NOLINTBEGIN(readability-magic-numbers) — test file
+
+#include "strong-types/strong_id.hpp"
+#include "strong-types/strong.hpp"
+
+#include <cstdint>
+#include <ranges>
+#include <type_traits>
+
+using namespace strong_types;
+
+namespace
+{
+
+struct JointTag;
+struct LinkTag;
+using JointId = StrongId<std::uint32_t, JointTag>;
+using LinkId = StrongId<std::uint32_t, LinkTag>;
+
+struct Joint
+{
+    double angle = 0.0;
+    constexpr bool operator==(const Joint &) const = default;
+};
+
+template <typename Table, typename Id>
+concept IndexableBy = requires(Table &table, Id id) { table[id]; };
+
+template <typename Id>
+concept HasArithmetic = requires(Id lhs, Id rhs) { lhs + rhs; };
+
+} // namespace
+
+// ---- StrongId is opaque ----
+
+static_assert(!HasArithmetic<JointId>);
+static_assert(!Arithmetic<JointId>);
+static_assert(!std::is_convertible_v<std::uint32_t, JointId>);
+static_assert(!std::is_convertible_v<JointId, std::uint32_t>);
+static_assert(!std::is_constructible_v<JointId, std::int32_t>);
+static_assert(!std::is_constructible_v<JointId, std::uint64_t>);
+static_assert(std::is_constructible_v<JointId, std::uint16_t>);
+static_assert(!std::is_constructible_v<JointId, LinkId>);
+static_assert(!std::equality_comparable_with<JointId, LinkId>);
+static_assert(StrongIdType<JointId> && !StrongIdType<std::uint32_t>);
+
+static_assert(!JointId{}.is_valid() && JointId{} == JointId::invalid());
+static_assert(JointId{std::uint32_t{3}} < JointId{std::uint32_t{7}});
+static_assert(JointId::from_index(5).get() == 5U && JointId::from_index(5).index() == 5);
+
+// Indices at or past the sentinel map to invalid() instead of wrapping onto valid IDs
+using SmallId = StrongId<std::uint8_t, struct SmallTag>;
+static_assert(SmallId::max_count() == 255 && SmallId::from_index(254).is_valid());
+static_assert(SmallId::from_index(255) == SmallId::invalid() && SmallId::from_index(256) == SmallId::invalid());
+static_assert(StrongVector<SmallId, int>{}.max_size() == 255);
+static_assert([]
+              {
+                  StrongVector<SmallId, int> small;
+                  SmallId last{};
+                  for (int i = 0; i < 255; ++i)
+                  {
+                      last = small.push_back(i);
+                  }
+                  return last.get() == 254 && small.size() == small.max_size() && small.contains(last);
+              }());
+
+// ---- StrongVector is indexed only by its ID type ----
+
+static_assert(IndexableBy<StrongVector<JointId, Joint>, JointId>);
+static_assert(!IndexableBy<StrongVector<JointId, Joint>, LinkId>);
+static_assert(!IndexableBy<StrongVector<JointId, Joint>, std::size_t>);
+
+static_assert([]
+              {
+                  StrongVector<JointId, Joint> joints;
+                  const JointId shoulder = joints.push_back(Joint{0.5});
+                  const JointId elbow = joints.emplace_back(1.5);
+                  joints[elbow].angle += 1.0;
+                  return shoulder.index() == 0 && elbow.index() == 1 && joints.size() == 2 &&
+                         joints[elbow].angle == 2.5 && joints.next_id() == JointId::from_index(2);
+              }());
+
+static_assert([]
+              {
+                  const StrongVector<JointId, Joint> joints{Joint{1.0}, Joint{2.0}};
+                  return joints.contains(JointId::from_index(1)) && !joints.contains(JointId::from_index(2)) &&
+                         !joints.contains(JointId::invalid()) && joints.find(JointId::from_index(2)) == nullptr &&
+                         joints.find(JointId::from_index(0))->angle == 1.0;
+              }());
+
+static_assert([]
+              {
+                  StrongVector<LinkId, int> links(4, 1);
+                  int weighted = 0;
+                  for (const LinkId id : links.ids())
+                  {
+                      weighted += links[id] * static_cast<int>(id.get());
+                  }
+                  int total = 0;
+                  for (const int link : links)
+                  {
+                      total += link;
+                  }
+                  return weighted == 6 && total == 4 && std::ranges::distance(links.ids()) == 4;
+              }());
+
+// NOLINTEND(readability-magic-numbers)
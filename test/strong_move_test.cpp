@@ -0,0 +1,206 @@
+// NOLINTBEGIN(readability-magic-numbers) — test file
+
+#include "strong-types/strong.hpp"
+
+#include <compare>
+#include <type_traits>
+#include <utility>
+
+// A payload that records how many times it (or a value it was built from) was copied
+struct Counted
+{
+    int value{};
+    int copies{};
+
+    constexpr Counted() = default;
+    constexpr explicit Counted(int v) : value(v)
+    {
+    }
+    constexpr Counted(const Counted &other) : value(other.value), copies(other.copies + 1)
+    {
+    }
+    constexpr Counted(Counted &&other) noexcept : value(other.value), copies(other.copies)
+    {
+    }
+    constexpr Counted &operator=(const Counted &other)
+    {
+        value = other.value;
+        copies = other.copies + 1;
+        return *this;
+    }
+    constexpr Counted &operator=(Counted &&other) noexcept
+    {
+        value = other.value;
+        copies = other.copies;
+        return *this;
+    }
+    constexpr ~Counted() = default;
+
+    constexpr Counted &operator+=(const Counted &rhs)
+    {
+        value += rhs.value;
+        return *this;
+    }
+    constexpr Counted &operator-=(const Counted &rhs)
+    {
+        value -= rhs.value;
+        return *this;
+    }
+    constexpr Counted &operator*=(int scalar)
+    {
+        value *= scalar;
+        return *this;
+    }
+    constexpr Counted &operator/=(int scalar)
+    {
+        value /= scalar;
+        return *this;
+    }
+
+    friend constexpr Counted operator+(const Counted &lhs, const Counted &rhs)
+    {
+        return Counted{lhs.value + rhs.value};
+    }
+    friend constexpr Counted operator-(const Counted &lhs, const Counted &rhs)
+    {
+        return Counted{lhs.value - rhs.value};
+    }
+    friend constexpr Counted operator*(const Counted &lhs, const Counted &rhs)
+    {
+        return Counted{lhs.value * rhs.value};
+    }
+    friend constexpr Counted operator/(const Counted &lhs, const Counted &rhs)
+    {
+        return Counted{lhs.value / rhs.value};
+    }
+    friend constexpr Counted operator-(const Counted &val)
+    {
+        return Counted{-val.value};
+    }
+    friend constexpr bool operator==(const Counted &lhs, const Counted &rhs)
+    {
+        return lhs.value == rhs.value;
+    }
+    friend constexpr auto operator<=>(const Counted &lhs, const Counted &rhs)
+    {
+        return lhs.value <=> rhs.value;
+    }
+};
+
+struct CountedTag
+{
+};
+
+namespace strong_types
+{
+template <>
+struct tag_sum_result<CountedTag, CountedTag>
+{
+    using type = CountedTag;
+};
+template <>
+struct tag_difference_result<CountedTag, CountedTag>
+{
+    using type = CountedTag;
+};
+} // namespace strong_types
+
+using CountedQ = strong_types::Strong<Counted, CountedTag>;
+
+// ---- accessors ----
+
+static_assert(std::is_same_v<decltype(std::declval<const CountedQ &>().get()), const Counted &>);
+static_assert(std::is_same_v<decltype(std::declval<CountedQ &>().get()), Counted &>);
+static_assert(std::is_same_v<decltype(std::declval<CountedQ &&>().get()), Counted>);
+
+// Arithmetic payloads stay read-only: a plain double can only change through the unit-checked operators
+static_assert(std::is_same_v<decltype(std::declval<strong_types::Strong<double, CountedTag> &>().get()),
+                             const double &>);
+
+static_assert([]
+              {
+                  const CountedQ q{Counted{4}};
+                  const Counted &ref = q.get();
+                  return ref.value == 4 && ref.copies == 0;
+              }());
+
+static_assert([]
+              {
+                  CountedQ q{Counted{4}};
+                  const Counted moved = std::move(q).get();
+                  return moved.value == 4 && moved.copies == 0;
+              }());
+
+// ---- compound assignment works in place ----
+
+static_assert([]
+              {
+                  CountedQ a{Counted{5}};
+                  const CountedQ b{Counted{3}};
+                  a += b;
+                  a -= CountedQ{Counted{1}};
+                  a *= 4;
+                  a /= 2;
+                  return a.get().value == 14 && a.get().copies == 0;
+              }());
+
+// ---- rvalue operands reuse their storage ----
+
+static_assert([]
+              {
+                  const CountedQ a{Counted{1}};
+                  const CountedQ b{Counted{2}};
+                  const CountedQ c{Counted{3}};
+                  const CountedQ sum = a + b + c + CountedQ{Counted{4}};
+                  return sum.get().value == 10 && sum.get().copies == 0;
+              }());
+
+static_assert([]
+              {
+                  const CountedQ a{Counted{10}};
+                  const CountedQ diff = (a + a) - a;
+                  const CountedQ scaled = 3 * ((a + a) * 2);
+                  return diff.get().value == 10 && scaled.get().value == 120 && scaled.get().copies == 0;
+              }());
+
+static_assert([]
+              {
+                  const CountedQ a{Counted{7}};
+                  const CountedQ sum = a + CountedQ{Counted{1}}; // rvalue on the right
+                  return sum.get().value == 8 && sum.get().copies == 0;
+              }());
+
+// lvalue operands are left untouched
+static_assert([]
+              {
+                  const CountedQ a{Counted{2}};
+                  CountedQ b{Counted{3}};
+                  const CountedQ sum = a + b;
+                  return sum.get().value == 5 && a.get().value == 2 && b.get().value == 3;
+              }());
+
+// ---- arithmetic payloads keep value semantics ----
+
+struct PlainTag
+{
+};
+
+namespace strong_types
+{
+template <>
+struct tag_sum_result<PlainTag, PlainTag>
+{
+    using type = PlainTag;
+};
+} // namespace strong_types
+
+static_assert([]
+              {
+                  strong_types::Strong<int, PlainTag> s{100};
+                  s += strong_types::Strong<int, PlainTag>{20};
+                  return s.get() == 120;
+              }());
+
+static_assert(std::is_same_v<decltype(std::declval<strong_types::Strong<double, PlainTag> &&>().get()), double>);
+
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,140 @@
+// NOLINTBEGIN(readability-magic-numbers) — test file
+#include <doctest/doctest.h>
+
+#include "strong-types/clock.hpp"
+#include "strong-types/time_index.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace strong_types;
+
+namespace
+{
+
+using Stamp = SteadyTimePoint<std::int64_t>;
+
+std::vector<Stamp> stamps_from(std::initializer_list<std::int64_t> values)
+{
+    std::vector<Stamp> stamps;
+    for (const auto value : values)
+    {
+        stamps.emplace_back(value);
+    }
+    return stamps;
+}
+
+Stamp at(std::int64_t value)
+{
+    return Stamp{value};
+}
+
+} // namespace
+
+TEST_CASE("TimeIndex rejects unsorted columns")
+{
+    const auto unsorted = stamps_from({1, 3, 2});
+    const auto index = TimeIndex<Stamp>::create(unsorted);
+    REQUIRE_FALSE(index);
+    CHECK(index.error() == IndexErrc::not_sorted);
+}
+
+TEST_CASE("TimeIndex single queries")
+{
+    const auto stamps = stamps_from({10, 20, 20, 30, 50});
+    const auto index = TimeIndex<Stamp>::create(stamps);
+    REQUIRE(index);
+
+    CHECK(index->lower_bound(at(5)) == 0);
+    CHECK(index->lower_bound(at(20)) == 1);
+    CHECK(index->lower_bound(at(21)) == 3);
+    CHECK(index->lower_bound(at(51)) == 5);
+
+    CHECK(index->nearest(at(-100)) == 0);
+    CHECK(index->nearest(at(24)) == 2); // the later of the equal samples
+    CHECK(index->nearest(at(26)) == 3);
+    CHECK(index->nearest(at(40)) == 3); // tie: the earlier sample
+    CHECK(index->nearest(at(999)) == 4);
+
+    CHECK(*index->bracket(at(35)) == std::pair<std::size_t, std::size_t>{3, 4});
+    CHECK(*index->bracket(at(30)) == std::pair<std::size_t, std::size_t>{3, 3});
+    CHECK(*index->bracket(at(10)) == std::pair<std::size_t, std::size_t>{0, 0});
+    CHECK(index->bracket(at(9)).error() == IndexErrc::out_of_range);
+    CHECK(index->bracket(at(51)).error() == IndexErrc::out_of_range);
+}
+
+TEST_CASE("TimeIndex nearest does not overflow narrow keys")
+{
+    using Short = unit_t<std::int16_t, LengthTag>;
+    const std::vector<Short> column{Short{std::int16_t{-30000}}, Short{std::int16_t{30000}}};
+    const auto index = TimeIndex<Short>::create(column);
+    REQUIRE(index);
+    CHECK(index->nearest(Short{std::int16_t{20000}}) == 1);
+    CHECK(index->nearest(Short{std::int16_t{-20000}}) == 0);
+
+    using Tick = unit_t<std::uint8_t, LengthTag>;
+    const std::vector<Tick> ticks{Tick{std::uint8_t{0}}, Tick{std::uint8_t{255}}};
+    const auto unsigned_index = TimeIndex<Tick>::create(ticks);
+    REQUIRE(unsigned_index);
+    CHECK(unsigned_index->nearest(Tick{std::uint8_t{200}}) == 1);
+}
+
+TEST_CASE("TimeIndex on an empty column")
+{
+    const std::vector<Stamp> none;
+    const auto index = TimeIndex<Stamp>::create(none);
+    REQUIRE(index);
+    CHECK(index->lower_bound(at(1)) == 0);
+    CHECK(index->nearest(at(1)) == 0);
+    CHECK(index->bracket(at(1)).error() == IndexErrc::empty);
+}
+
+TEST_CASE("TimeIndex agrees with std::lower_bound at every size")
+{
+    std::mt19937_64 rng{5};
+    for (std::size_t size : {1U, 2U, 3U, 7U, 8U, 9U, 100U, 1000U, 4097U})
+    {
+        std::uniform_int_distribution<std::int64_t> dist{0, static_cast<std::int64_t>(size) * 3};
+        std::vector<Stamp> stamps;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            stamps.emplace_back(dist(rng));
+        }
+        std::sort(stamps.begin(), stamps.end());
+        const auto index = TimeIndex<Stamp>::create(stamps);
+        REQUIRE(index);
+
+        std::vector<Stamp> queries;
+        for (std::int64_t q = -1; q <= static_cast<std::int64_t>(size) * 3 + 1; ++q)
+        {
+            queries.emplace_back(q);
+        }
+        std::vector<std::size_t> bounds(queries.size());
+        std::vector<std::size_t> nearest(queries.size());
+        std::vector<std::pair<std::size_t, std::size_t>> brackets(queries.size());
+        REQUIRE(index->lower_bound(queries, bounds));
+        REQUIRE(index->nearest(queries, nearest));
+        REQUIRE(index->bracket(queries, brackets));
+
+        bool agree = true;
+        for (std::size_t i = 0; i < queries.size(); ++i)
+        {
+            const auto expected = static_cast<std::size_t>(std::lower_bound(stamps.begin(), stamps.end(), queries[i]) -
+                                                           stamps.begin());
+            agree = agree && bounds[i] == expected && index->lower_bound(queries[i]) == expected;
+            agree = agree && nearest[i] == index->nearest(queries[i]);
+            const auto single = index->bracket(queries[i]);
+            agree = agree && (single ? *single == brackets[i] : brackets[i].first == size);
+        }
+        CHECK(agree);
+    }
+
+    const auto stamps = stamps_from({1, 2});
+    std::vector<std::size_t> short_out(1);
+    CHECK(TimeIndex<Stamp>::create(stamps)->lower_bound(stamps, short_out).error() == IndexErrc::size_mismatch);
+}
+
+// NOLINTEND(readability-magic-numbers)
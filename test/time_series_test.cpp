@@ -0,0 +1,152 @@
+// NOLINTBEGIN(readability-magic-numbers) — test file
+#include <doctest/doctest.h>
+
+#include "strong-types/clock.hpp"
+#include "strong-types/si.hpp"
+#include "strong-types/time_series.hpp"
+
+#include <cstdint>
+#include <vector>
+
+using namespace strong_types;
+
+namespace
+{
+
+using Stamp = SteadyTimePoint<std::int64_t>;
+using Depth = unit_t<double, LengthTag>;
+using Series = TimeSeries<Stamp, Depth, 8>;
+
+Stamp at(std::int64_t value)
+{
+    return Stamp{value};
+}
+
+/// Samples at t = 0, 10, 20, ... with value i
+Series make_series(std::int64_t samples)
+{
+    Series series;
+    for (std::int64_t i = 0; i < samples; ++i)
+    {
+        REQUIRE(series.append(at(i * 10), Depth{static_cast<double>(i)}));
+    }
+    return series;
+}
+
+} // namespace
+
+TEST_CASE("TimeSeries appends into fixed chunks without moving old samples")
+{
+    Series series;
+    CHECK(series.empty());
+    CHECK(series.back_time().error() == SeriesErrc::empty);
+
+    REQUIRE(series.append(at(5), Depth{1.0}));
+    const double *first_value = series.chunk(0).second.raw().data();
+    for (std::int64_t i = 1; i < 20; ++i)
+    {
+        REQUIRE(series.append(at(5 + i), Depth{static_cast<double>(i)}));
+    }
+    CHECK(series.size() == 20);
+    CHECK(series.chunk_count() == 3);
+    CHECK(series.chunk(0).second.raw().data() == first_value);
+    CHECK(series.chunk(2).first.size() == 4);
+    CHECK(reinterpret_cast<std::uintptr_t>(first_value) % SOA_COLUMN_ALIGNMENT == 0);
+
+    CHECK(series[9].first == at(14));
+    CHECK(series[9].second == Depth{9.0});
+    CHECK(*series.front_time() == at(5));
+    CHECK(*series.back_time() == at(24));
+
+    CHECK(series.append(at(24), Depth{0.0})); // equal times are allowed
+    CHECK(series.append(at(23), Depth{0.0}).error() == SeriesErrc::out_of_order);
+    CHECK(series.size() == 21);
+}
+
+TEST_CASE("TimeSeries reserve and clear keep the chunks")
+{
+    Series series;
+    series.reserve(20);
+    CHECK(series.chunk_count() == 0);
+    for (std::int64_t i = 0; i < 20; ++i)
+    {
+        REQUIRE(series.append(at(i), Depth{1.0}));
+    }
+    const double *values = series.chunk(1).second.raw().data();
+    series.clear();
+    CHECK(series.empty());
+    for (std::int64_t i = 0; i < 12; ++i)
+    {
+        REQUIRE(series.append(at(i), Depth{2.0}));
+    }
+    CHECK(series.chunk(1).second.raw().data() == values);
+    CHECK(*series.minmax(at(0), at(100)) == std::pair{Depth{2.0}, Depth{2.0}});
+}
+
+TEST_CASE("TimeSeries range queries")
+{
+    const auto series = make_series(30); // chunks of 8: [0, 70], [80, 150], [160, 230], [240, 290]
+
+    CHECK(series.lower_bound(at(-1)) == 0);
+    CHECK(series.lower_bound(at(80)) == 8);
+    CHECK(series.lower_bound(at(81)) == 9);
+    CHECK(series.lower_bound(at(75)) == 8);
+    CHECK(series.lower_bound(at(291)) == 30);
+
+    CHECK(series.range(at(25), at(95)) == std::pair<std::size_t, std::size_t>{3, 10});
+    CHECK(series.count(at(95), at(25)) == 0);
+    CHECK(series.count(at(0), at(1000)) == 30);
+
+    std::vector<std::size_t> slices;
+    double seen = 0.0;
+    series.for_each_slice(at(50), at(250), [&](auto times, auto values) {
+        slices.push_back(times.size());
+        CHECK(times.size() == values.size());
+        seen += sum(values).get();
+    });
+    CHECK(slices == std::vector<std::size_t>{3, 8, 8, 1}); // samples 5..24
+    CHECK(seen == 290.0);
+}
+
+TEST_CASE("TimeSeries aggregations match a linear scan")
+{
+    const auto series = make_series(30);
+    for (std::int64_t from = -10; from <= 300; from += 15)
+    {
+        for (std::int64_t to = from; to <= 310; to += 35)
+        {
+            double total = 0.0;
+            double lo = 1e9;
+            double hi = -1e9;
+            std::size_t samples = 0;
+            for (std::size_t i = 0; i < series.size(); ++i)
+            {
+                if (series.time(i) >= at(from) && series.time(i) < at(to))
+                {
+                    const double v = series.value(i).get();
+                    total += v;
+                    lo = v < lo ? v : lo;
+                    hi = v > hi ? v : hi;
+                    ++samples;
+                }
+            }
+            CHECK(series.count(at(from), at(to)) == samples);
+            CHECK(series.sum(at(from), at(to)).get() == total);
+            const auto extremes = series.minmax(at(from), at(to));
+            const auto average = series.mean(at(from), at(to));
+            if (samples == 0)
+            {
+                CHECK(extremes.error() == SeriesErrc::empty);
+                CHECK(average.error() == SeriesErrc::empty);
+            }
+            else
+            {
+                CHECK(extremes->first.get() == lo);
+                CHECK(extremes->second.get() == hi);
+                CHECK(average->get() == total / static_cast<double>(samples));
+            }
+        }
+    }
+}
+
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,125 @@
+// NOLINTBEGIN(readability-magic-numbers) — test file
+
+#include "strong-types/unit_mdspan.hpp"
+
+#if defined(STRONG_TYPES_REQUIRE_MDSPAN) && !STRONG_TYPES_HAS_MDSPAN
+#error "STRONG_TYPES_REQUIRE_MDSPAN is set but the standard library has no <mdspan> (__cpp_lib_mdspan >= 202207L)"
+#endif
+
+#if STRONG_TYPES_HAS_MDSPAN
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mdspan>
+
+using namespace strong_types;
+
+namespace
+{
+
+using Meters = unit_t<double, LengthTag>;
+using Seconds = unit_t<double, TimeTag>;
+using Speed = unit_t<double, SpeedTag>;
+using Grid = std::dextents<std::size_t, 2>;
+
+} // namespace
+
+// ---- accessor ----
+
+static_assert(std::is_same_v<unit_mdspan<double, LengthTag, Grid>::element_type, Meters>);
+static_assert(std::is_same_v<unit_mdspan<const double, LengthTag, Grid>::element_type, const Meters>);
+static_assert(std::is_same_v<unit_mdspan<const double, LengthTag, Grid>::reference, Meters>);
+static_assert(std::is_same_v<unit_mdspan<double, LengthTag, Grid>::data_handle_type, double *>);
+
+static_assert([]
+              {
+                  std::array<double, 6> raw{1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+                  const unit_mdspan<double, LengthTag, Grid> grid{raw.data(), 2, 3};
+                  grid[1, 2] = Meters{60.0};
+                  grid[0, 0] += Meters{9.0};
+                  const Meters read = grid[1, 0];
+                  const unit_mdspan<const double, LengthTag, Grid> view{raw.data(), 2, 3};
+                  return read == Meters{4.0} && raw[5] == 60.0 && raw[0] == 10.0 && view[0, 1] == Meters{2.0};
+              }());
+
+static_assert([]
+              {
+                  std::array<std::int64_t, 4> raw{};
+                  const scaled_mdspan<std::int64_t, TimeTag, std::milli, std::extents<std::size_t, 2, 2>> ms{
+                      raw.data()};
+                  ms[1, 1] = Milliseconds<std::int64_t>{std::int64_t{250}};
+                  return raw[3] == 250 && ms[1, 1].get() == Milliseconds<std::int64_t>{std::int64_t{250}};
+              }());
+
+// ---- layouts ----
+
+static_assert([]
+              {
+                  using Mapping = layout_aligned_rows<double>::mapping<Grid>;
+                  const Mapping mapping{Grid{3, 5}};
+                  return mapping.row_stride() == 8 && mapping(1, 0) == 8 && mapping(2, 4) == 20 &&
+                         mapping.required_span_size() == 21 && mapping.stride(0) == 8 && mapping.stride(1) == 1 &&
+                         !mapping.is_exhaustive();
+              }());
+
+static_assert(layout_aligned_rows<float>::mapping<Grid>{Grid{2, 16}}.is_exhaustive());
+static_assert(layout_padded_rows<4>::mapping<std::dextents<std::size_t, 3>>{std::dextents<std::size_t, 3>{2, 3, 5}}
+                  .stride(0) == 24);
+
+static_assert([]
+              {
+                  // 5x5 in 2x4 tiles: 3 tile rows, 2 tiles per row, 8 elements per tile
+                  const layout_tiled<2, 4>::mapping<Grid> mapping{Grid{5, 5}};
+                  return mapping.required_span_size() == 48 && mapping(0, 0) == 0 && mapping(0, 3) == 3 &&
+                         mapping(1, 0) == 4 && mapping(0, 4) == 8 && mapping(2, 0) == 16 && mapping(4, 4) == 40 &&
+                         !mapping.is_exhaustive() && !mapping.is_strided();
+              }());
+
+// ---- algorithms ----
+
+static_assert([]
+              {
+                  // 2x3 in padded rows of 8: slots 3..7 are padding and must be ignored
+                  std::array<double, 16> raw{};
+                  raw.fill(-100.0);
+                  using Padded = layout_aligned_rows<double>;
+                  const unit_mdspan<double, LengthTag, Grid, Padded> grid{raw.data(), Padded::mapping<Grid>{Grid{2, 3}}};
+                  fill(grid, Meters{1.0});
+                  grid[1, 2] = Meters{5.0};
+
+                  std::array<double, 2> rows{};
+                  const auto ok = row_sums(grid, unit_span<double, LengthTag>{std::span{rows}});
+                  std::array<double, 1> wrong{};
+                  const auto bad = row_sums(grid, unit_span<double, LengthTag>{std::span{wrong}});
+                  return ok && rows[0] == 3.0 && rows[1] == 7.0 && sum(grid) == Meters{10.0} && raw[3] == -100.0 &&
+                         !bad && bad.error() == SpanErrc::size_mismatch;
+              }());
+
+static_assert([]
+              {
+                  std::array<double, 4> distance{10.0, 20.0, 30.0, 40.0};
+                  std::array<double, 4> time{2.0, 4.0, 5.0, 8.0};
+                  std::array<double, 4> speed{};
+                  const unit_mdspan<const double, LengthTag, Grid> d{distance.data(), 2, 2};
+                  const unit_mdspan<const double, TimeTag, Grid> t{time.data(), 2, 2};
+                  const unit_mdspan<double, SpeedTag, Grid> v{speed.data(), 2, 2};
+                  const auto ok = elementwise(v, [](Meters m, Seconds s) { return m / s; }, d, t);
+                  const unit_mdspan<const double, TimeTag, Grid> short_t{time.data(), 1, 2};
+                  const auto bad = elementwise(v, [](Meters m, Seconds s) { return m / s; }, d, short_t);
+                  return ok && speed[0] == 5.0 && speed[2] == 6.0 && speed[3] == 5.0 && !bad &&
+                         v[1, 1] == Speed{5.0};
+              }());
+
+static_assert([]
+              {
+                  std::array<float, 64> raw{};
+                  using Tiled = layout_tiled<4, 4>;
+                  const unit_mdspan<float, LengthTag, Grid, Tiled> tiles{raw.data(), Tiled::mapping<Grid>{Grid{6, 6}}};
+                  fill(tiles, unit_t<float, LengthTag>{0.5F});
+                  return sum(tiles).get() == 18.0F;
+              }());
+
+#endif // STRONG_TYPES_HAS_MDSPAN
+
+// NOLINTEND(readability-magic-numbers)
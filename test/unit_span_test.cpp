@@ -0,0 +1,145 @@
+// NOLINTBEGIN(readability-magic-numbers) — test file
+
+#include "strong-types/unit_span.hpp"
+
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <span>
+
+using namespace strong_types;
+
+// ---- layout contract ----
+
+static_assert(ValueLayout<unit_t<double, LengthTag>>);
+static_assert(ValueLayout<unit_t<float, TimeTag>>);
+static_assert(ValueLayout<unit_t<std::int64_t, MassTag>>);
+static_assert(ValueLayout<Millimeters<double>>);
+static_assert(ValueLayout<Nanoseconds<std::int64_t>>);
+
+static_assert(std::random_access_iterator<unit_span<const double, LengthTag>::iterator>);
+static_assert(std::ranges::random_access_range<scaled_span<float, TimeTag, std::milli>>);
+static_assert(sizeof(unit_span<double, LengthTag>) == sizeof(std::span<double>));
+
+// ---- element access ----
+
+static_assert([]
+              {
+                  constexpr std::array<double, 3> raw{1.0, 2.5, -4.0};
+                  const unit_span<const double, LengthTag> view{raw.data(), raw.size()};
+                  return view.size() == 3 && view[1] == unit_t<double, LengthTag>{2.5} &&
+                         *view.begin() == unit_t<double, LengthTag>{1.0} && view.end() - view.begin() == 3 &&
+                         view.raw().data() == raw.data();
+              }());
+
+static_assert([]
+              {
+                  std::array<double, 4> raw{};
+                  const auto view = view_as<Millimeters<double>>(std::span{raw});
+                  view.set(2, Millimeters<double>{7.5});
+                  fill(view.first(2), Millimeters<double>{1.0});
+                  return raw[0] == 1.0 && raw[1] == 1.0 && raw[2] == 7.5 && raw[3] == 0.0;
+              }());
+
+static_assert([]
+              {
+                  std::array<float, 3> raw{1.0F, 2.0F, 3.0F};
+                  const scaled_span<float, TimeTag, std::milli> writable{std::span{raw}};
+                  const scaled_span<const float, TimeTag, std::milli> readonly = writable;
+                  float total = 0.0F;
+                  for (const auto ms : readonly.subspan(1))
+                  {
+                      total += ms.get();
+                  }
+                  return total == 5.0F && readonly.last(1)[0] == Milliseconds<float>{3.0F};
+              }());
+
+// ---- reductions ----
+
+static_assert([]
+              {
+                  constexpr std::array<double, 4> raw{3.0, -1.0, 4.0, 2.0};
+                  const unit_span<const double, LengthTag> view{std::span{raw}};
+                  const auto range = minmax(view);
+                  return sum(view) == unit_t<double, LengthTag>{8.0} && mean(view)->get() == 2.0 &&
+                         range->first.get() == -1.0 && range->second.get() == 4.0;
+              }());
+
+static_assert([]
+              {
+                  const unit_span<const double, LengthTag> none{};
+                  return !mean(none) && mean(none).error() == SpanErrc::empty && !minmax(none) &&
+                         sum(none).get() == 0.0;
+              }());
+
+static_assert([]
+              {
+                  constexpr std::array<std::int64_t, 3> raw{10, 20, 31};
+                  const scaled_span<const std::int64_t, TimeTag, std::nano> view{std::span{raw}};
+                  return sum(view).get() == 61 && mean(view)->get() == 20;
+              }());
+
+// ---- bulk conversion ----
+
+static_assert([]
+              {
+                  constexpr std::array<double, 3> km{1.0, 0.5, 2.0};
+                  std::array<double, 3> m{};
+                  const auto ok = convert(scaled_span<const double, LengthTag, std::kilo>{std::span{km}},
+                                          unit_span<double, LengthTag>{std::span{m}});
+                  return ok.has_value() && m[0] == 1000.0 && m[1] == 500.0 && m[2] == 2000.0;
+              }());
+
+static_assert([]
+              {
+                  constexpr std::array<std::int64_t, 2> ms{1500, 2};
+                  std::array<std::int64_t, 2> us{};
+                  std::array<double, 2> s{};
+                  const scaled_span<const std::int64_t, TimeTag, std::milli> src{std::span{ms}};
+                  const auto a = convert(src, scaled_span<std::int64_t, TimeTag, std::micro>{std::span{us}});
+                  const auto b = convert(src, unit_span<double, TimeTag>{std::span{s}});
+                  return a && b && us[0] == 1'500'000 && us[1] == 2'000 && s[0] == 1.5 && s[1] == 0.002;
+              }());
+
+static_assert([]
+              {
+                  constexpr std::array<double, 3> src{1.0, 2.0, 3.0};
+                  std::array<double, 2> dst{};
+                  const auto result = convert(unit_span<const double, LengthTag>{std::span{src}},
+                                              unit_span<double, LengthTag>{std::span{dst}});
+                  return !result && result.error() == SpanErrc::size_mismatch;
+              }());
+
+// Integer targets keep a fractional source's fraction until the final cast
+static_assert([]
+              {
+                  constexpr std::array<double, 3> m{1.5, 0.25, -0.0015};
+                  std::array<long, 3> mm{};
+                  const auto ok = convert(unit_span<const double, LengthTag>{std::span{m}},
+                                          scaled_span<long, LengthTag, std::milli>{std::span{mm}});
+                  return ok && mm[0] == 1500 && mm[1] == 250 && mm[2] == -1;
+              }());
+
+// Large ratios: x * num would overflow int64, x / den * num + remainder does not
+static_assert([]
+              {
+                  constexpr std::array<std::int64_t, 2> ns{9'000'000'000'000'000'123, -1'999};
+                  std::array<std::int64_t, 2> ms{};
+                  const auto ok = convert(scaled_span<const std::int64_t, TimeTag, std::nano>{std::span{ns}},
+                                          scaled_span<std::int64_t, TimeTag, std::milli>{std::span{ms}});
+                  return ok && ms[0] == 9'000'000'000'000 && ms[1] == 0;
+              }());
+
+static_assert([]
+              {
+                  using Tenths = std::ratio<1, 10>;
+                  using Thirds = std::ratio<1, 3>;
+                  constexpr std::array<std::int64_t, 2> tenths{9'000'000'000'000'000'000, 7};
+                  std::array<std::int64_t, 2> thirds{};
+                  const auto ok = convert(scaled_span<const std::int64_t, TimeTag, Tenths>{std::span{tenths}},
+                                          scaled_span<std::int64_t, TimeTag, Thirds>{std::span{thirds}});
+                  return ok && thirds[0] == 2'700'000'000'000'000'000 && thirds[1] == 2;
+              }());
+
+// NOLINTEND(readability-magic-numbers)
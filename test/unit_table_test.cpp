@@ -0,0 +1,69 @@
+// NOLINTBEGIN(readability-magic-numbers) — test file
+#include "strong-types/si_scaled.hpp"
+#include "strong-types/unit_table.hpp"
+
+#include <array>
+#include <span>
+
+using namespace strong_types;
+
+// ---- suffix -> ID ----
+
+static_assert(find_unit("mm").value() == unit_id_v<Millimeters<double>>, "mm");
+static_assert(find_unit("km/h").value() == unit_id_v<KilometersPerHour<float>>, "value type does not matter");
+static_assert(find_unit("us").value() == unit_id_v<Microseconds<double>>, "us");
+static_assert(find_unit("m").value() == unit_id_v<unit_t<double, LengthTag>>, "base unit");
+static_assert(find_unit("kg/m3").value() == unit_id_v<unit_t<double, DensityTag>>, "compound suffix");
+static_assert(find_unit("furlong").error() == UnitErrc::unknown_unit, "unknown suffix");
+static_assert(find_unit("").error() == UnitErrc::unknown_unit, "empty suffix");
+static_assert(find_unit("MM").error() == UnitErrc::unknown_unit, "suffixes are case sensitive");
+
+static_assert([]
+              {
+    for (std::size_t i = 0; i < unit_table().size(); ++i)
+    {
+        const auto id = find_unit(unit_table()[i].suffix);
+        if (!id || *id != i)
+        {
+            return false;
+        }
+    }
+    return true; }(), "every registered suffix round-trips to its dense ID");
+
+// ---- table contents ----
+
+static_assert(unit_table()[unit_id_v<Kilometers<double>>].num == 1000, "km = 1000 m");
+static_assert(unit_table()[unit_id_v<Hours<double>>].base == unit_id_v<unit_t<double, TimeTag>>, "hr is a time unit");
+static_assert(unit_table()[unit_id_v<Grams<double>>].den == 1000, "g = 1/1000 kg");
+
+// ---- conversion ----
+
+static_assert(convert(1.5, unit_id_v<Kilometers<double>>, unit_id_v<Millimeters<double>>).value() == 1500000.0,
+              "km -> mm");
+static_assert(convert(90.0, find_unit("min").value(), find_unit("hr").value()).value() == 1.5, "min -> hr");
+static_assert(convert(36.0, find_unit("km/h").value(), find_unit("m/s").value()).value() == 10.0, "km/h -> m/s");
+static_assert(convert(1.0, find_unit("km").value(), find_unit("s").value()).error() == UnitErrc::dimension_mismatch,
+              "length is not time");
+static_assert(conversion_factor(UnitId{200}, UnitId{0}).error() == UnitErrc::unknown_unit, "out-of-range ID");
+
+static_assert([]
+              {
+    constexpr std::array<double, 4> src{1.0, 2.0, 0.5, 250.0};
+    std::array<double, 4> dst{};
+    const auto ok = convert(src, find_unit("ms").value(), dst, find_unit("us").value());
+    return ok.has_value() && dst == std::array<double, 4>{1000.0, 2000.0, 500.0, 250000.0}; }(),
+              "bulk ms -> us with a runtime source ID");
+
+static_assert([]
+              {
+    constexpr std::array<double, 2> src{1.0, 2.0};
+    std::array<double, 3> dst{};
+    return convert(src, UnitId{0}, dst, UnitId{0}).error() == UnitErrc::size_mismatch; }(),
+              "bulk size mismatch");
+
+static_assert(quantity_from<Centimeters<double>>(2.0, find_unit("m").value()).value().get() == 200.0,
+              "decode into a typed quantity");
+static_assert(quantity_from<unit_t<double, MassTag>>(500.0, find_unit("g").value()).value().get() == 0.5,
+              "decode into a base unit");
+
+// NOLINTEND(readability-magic-numbers)